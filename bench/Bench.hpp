@@ -0,0 +1,150 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+    // Keeps the optimizer from discarding a value that is computed only to be measured
+    template<typename T>
+    inline void do_not_optimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const T *sink;
+        sink = &value;
+#endif
+    }
+
+    // Runs fn() `repeat` times and returns the best wall time in nanoseconds
+    template<typename Fn>
+    double measure_ns(Fn &&fn, int repeat = 5) {
+        double best = 0;
+        for (int i = 0; i < repeat; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            auto stop = std::chrono::steady_clock::now();
+            double elapsed = std::chrono::duration<double, std::nano>(stop - start).count();
+            if (i == 0 || elapsed < best) {
+                best = elapsed;
+            }
+        }
+        return best;
+    }
+
+    // Same as measure_ns, but runs setup() untimed before every repetition
+    template<typename Setup, typename Fn>
+    double measure_ns_with_setup(Setup &&setup, Fn &&fn, int repeat = 5) {
+        double best = 0;
+        for (int i = 0; i < repeat; ++i) {
+            setup();
+            double elapsed = measure_ns(fn, 1);
+            if (i == 0 || elapsed < best) {
+                best = elapsed;
+            }
+        }
+        return best;
+    }
+
+    // One reported measurement
+    struct Result {
+        std::string name;
+        std::size_t size;
+        double total_ns;
+        std::size_t ops;
+    };
+
+    // Every result reported by this process, in order
+    inline std::vector<Result> &results() {
+        static std::vector<Result> recorded;
+        return recorded;
+    }
+
+    // Prints one result line: name, problem size and time per operation
+    inline void report(const std::string &name, std::size_t size, double total_ns, std::size_t ops) {
+        results().push_back(Result{name, size, total_ns, ops});
+        std::cout << std::left << std::setw(52) << name
+                  << std::right << std::setw(10) << size
+                  << std::setw(12) << std::fixed << std::setprecision(2) << total_ns / ops << " ns/op\n";
+    }
+
+    // Reads --csv=<file> and --json=<file> from the command line and writes
+    // the results reported during its lifetime to those files on destruction
+    class Session {
+    public:
+        Session(int argc, char **argv) {
+            std::string program = argc > 0 ? argv[0] : "bench";
+            m_benchmark = program.substr(program.find_last_of("/\\") + 1);
+            for (int i = 1; i < argc; ++i) {
+                if (std::strncmp(argv[i], "--csv=", 6) == 0) {
+                    m_csv = argv[i] + 6;
+                } else if (std::strncmp(argv[i], "--json=", 7) == 0) {
+                    m_json = argv[i] + 7;
+                } else {
+                    std::cerr << "usage: " << m_benchmark << " [--csv=<file>] [--json=<file>]\n";
+                }
+            }
+        }
+
+        ~Session() {
+            if (!m_csv.empty()) {
+                write_csv();
+            }
+            if (!m_json.empty()) {
+                write_json();
+            }
+        }
+
+        Session(const Session &) = delete;
+        Session &operator=(const Session &) = delete;
+
+    private:
+        void write_csv() const {
+            std::ofstream out(m_csv);
+            out << "benchmark,name,size,ns_per_op,total_ns,ops\n" << std::setprecision(10);
+            for (const auto &result : results()) {
+                out << m_benchmark << ",\"" << result.name << "\"," << result.size << ','
+                    << result.total_ns / result.ops << ',' << result.total_ns << ',' << result.ops << '\n';
+            }
+        }
+
+        void write_json() const {
+            std::ofstream out(m_json);
+            out << "{\n  \"benchmark\": \"" << escaped(m_benchmark) << "\",\n"
+#if defined(__VERSION__)
+                << "  \"compiler\": \"" << escaped(__VERSION__) << "\",\n"
+#endif
+                << "  \"results\": [" << std::setprecision(10);
+            const char *separator = "\n";
+            for (const auto &result : results()) {
+                out << separator << "    {\"name\": \"" << escaped(result.name) << "\", \"size\": " << result.size
+                    << ", \"ns_per_op\": " << result.total_ns / result.ops << ", \"total_ns\": " << result.total_ns
+                    << ", \"ops\": " << result.ops << '}';
+                separator = ",\n";
+            }
+            out << "\n  ]\n}\n";
+        }
+
+        static std::string escaped(const std::string &text) {
+            std::string escaped;
+            for (char c : text) {
+                if (c == '"' || c == '\\') {
+                    escaped += '\\';
+                }
+                escaped += c;
+            }
+            return escaped;
+        }
+
+        std::string m_benchmark;
+        std::string m_csv;
+        std::string m_json;
+    };
+
+} // namespace bench
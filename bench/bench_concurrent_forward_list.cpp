@@ -0,0 +1,102 @@
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Bench.hpp"
+#include "ConcurrentForwardList.hpp"
+#include "Forward_list.hpp"
+
+// Throughput of a mixed workload from 1 to N threads: each thread pushes at
+// the front, pops from the front and reads the first elements in equal parts.
+// ConcurrentForwardList is lock-free, the baseline is the Forward_list behind
+// one global mutex that it replaces.
+
+namespace {
+    constexpr std::size_t ops_per_thread = 200'000;
+    constexpr std::size_t prefill = 1'000;
+    constexpr std::size_t scan_length = 16;
+
+    template<typename Fn>
+    double run_threads(std::size_t threads, Fn fn) {
+        return bench::measure_ns([&] {
+            std::vector<std::thread> workers;
+            for (std::size_t t = 0; t < threads; ++t) {
+                workers.emplace_back(fn, t);
+            }
+            for (auto &worker : workers) {
+                worker.join();
+            }
+        }, 3);
+    }
+
+    void bench_concurrent(std::size_t threads) {
+        container::ConcurrentForwardList<long> list;
+        for (std::size_t i = 0; i < prefill; ++i) {
+            list.push_front(static_cast<long>(i));
+        }
+        auto elapsed = run_threads(threads, [&](std::size_t t) {
+            long sum = 0;
+            for (std::size_t i = 0; i < ops_per_thread; ++i) {
+                switch (i % 3) {
+                case 0:
+                    list.push_front(static_cast<long>(t + i));
+                    break;
+                case 1:
+                    list.pop_front();
+                    break;
+                default: {
+                    auto guard = list.pin();
+                    std::size_t seen = 0;
+                    for (auto it = list.begin(); it != list.end() && seen < scan_length; ++it, ++seen) {
+                        sum += *it;
+                    }
+                }
+                }
+            }
+            bench::do_not_optimize(sum);
+        });
+        bench::report("ConcurrentForwardList<long> mixed", threads, elapsed, threads * ops_per_thread);
+    }
+
+    void bench_locked(std::size_t threads) {
+        std::mutex mutex;
+        container::Forward_list<long> list;
+        for (std::size_t i = 0; i < prefill; ++i) {
+            list.push_front(static_cast<long>(i));
+        }
+        auto elapsed = run_threads(threads, [&](std::size_t t) {
+            long sum = 0;
+            for (std::size_t i = 0; i < ops_per_thread; ++i) {
+                std::lock_guard<std::mutex> lock{mutex};
+                switch (i % 3) {
+                case 0:
+                    list.push_front(static_cast<long>(t + i));
+                    break;
+                case 1:
+                    if (!list.empty()) {
+                        list.pop_front();
+                    }
+                    break;
+                default: {
+                    std::size_t seen = 0;
+                    for (auto it = list.begin(); it != list.end() && seen < scan_length; ++it, ++seen) {
+                        sum += *it;
+                    }
+                }
+                }
+            }
+            bench::do_not_optimize(sum);
+        });
+        bench::report("mutex + Forward_list<long> mixed", threads, elapsed, threads * ops_per_thread);
+    }
+} // namespace
+
+// the size column is the number of threads
+int main(int argc, char **argv) {
+    bench::Session session{argc, argv};
+    const std::size_t cores = std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() : 2;
+    for (std::size_t threads = 1; threads <= cores; threads *= 2) {
+        bench_concurrent(threads);
+        bench_locked(threads);
+    }
+    return 0;
+}
@@ -0,0 +1,285 @@
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
+#include "Bench.hpp"
+#include "Vector.hpp"
+#include "List.hpp"
+#include "Forward_list.hpp"
+
+// Vector, List and Forward_list against their std counterparts: the common
+// modifiers, element access, iteration, copy, move and clear at several sizes
+// and element types. Run with --csv=<file> or --json=<file> to keep results.
+
+namespace {
+    // inserts, erases and indexed reads per measurement, the list ones include
+    // the walk to the middle
+    constexpr std::size_t middle_ops = 100;
+
+    struct Pod64 {
+        long long words[8];
+    };
+
+    template<typename T>
+    T make(std::size_t i);
+
+    template<>
+    int make<int>(std::size_t i) {
+        return static_cast<int>(i);
+    }
+
+    template<>
+    std::string make<std::string>(std::size_t i) {
+        return "element number " + std::to_string(i) + " (heap allocated)";
+    }
+
+    template<>
+    Pod64 make<Pod64>(std::size_t i) {
+        Pod64 pod{};
+        pod.words[0] = static_cast<long long>(i);
+        return pod;
+    }
+
+    template<typename T>
+    std::vector<T> make_values(std::size_t size) {
+        std::vector<T> values;
+        values.reserve(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            values.push_back(make<T>(i));
+        }
+        return values;
+    }
+
+    // Indexed access, std lists have no operator[] and walk instead
+    template<typename Container>
+    auto &at_index(Container &container, std::size_t index) {
+        return container[index];
+    }
+
+    template<typename T>
+    T &at_index(std::list<T> &list, std::size_t index) {
+        return *std::next(list.begin(), static_cast<std::ptrdiff_t>(index));
+    }
+
+    template<typename T>
+    T &at_index(std::forward_list<T> &list, std::size_t index) {
+        return *std::next(list.begin(), static_cast<std::ptrdiff_t>(index));
+    }
+
+    // Appends values at the back, std::forward_list has no push_back
+    template<typename Container, typename T>
+    void fill_back(Container &container, const std::vector<T> &values) {
+        for (const auto &value : values) {
+            container.push_back(value);
+        }
+    }
+
+    template<typename T>
+    void fill_back(std::forward_list<T> &list, const std::vector<T> &values) {
+        auto last = list.before_begin();
+        for (const auto &value : values) {
+            last = list.insert_after(last, value);
+        }
+    }
+
+    template<typename Iterator>
+    Iterator advanced(Iterator it, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            ++it;
+        }
+        return it;
+    }
+
+    // Operations every container supports in the same spelling
+    template<typename Container, typename T>
+    void bench_common(const std::string &name, const std::vector<T> &values) {
+        const std::size_t size = values.size();
+        Container container;
+        fill_back(container, values);
+
+        auto index = bench::measure_ns([&] {
+            for (std::size_t i = 0; i < middle_ops; ++i) {
+                bench::do_not_optimize(at_index(container, (i * 7919) % size));
+            }
+        });
+        bench::report(name + " operator[]", size, index, middle_ops);
+
+        auto iterate = bench::measure_ns([&] {
+            std::size_t count = 0;
+            for (const auto &value : container) {
+                bench::do_not_optimize(value);
+                ++count;
+            }
+            bench::do_not_optimize(count);
+        });
+        bench::report(name + " iterate", size, iterate, size);
+
+        auto copy = bench::measure_ns([&] {
+            Container copied(container);
+            bench::do_not_optimize(copied);
+        });
+        bench::report(name + " copy", size, copy, size);
+
+        auto move = bench::measure_ns([&] {
+            Container moved(std::move(container));
+            bench::do_not_optimize(moved);
+            container = std::move(moved);
+        });
+        bench::report(name + " move", size, move, 1);
+
+        Container filled;
+        auto clear = bench::measure_ns_with_setup([&] {
+            filled = container;
+        }, [&] {
+            filled.clear();
+            bench::do_not_optimize(filled);
+        });
+        bench::report(name + " clear", size, clear, size);
+    }
+
+    template<typename Container, typename T>
+    void bench_vector(const std::string &name, const std::vector<T> &values) {
+        const std::size_t size = values.size();
+        auto push_back = bench::measure_ns([&] {
+            Container container;
+            fill_back(container, values);
+            bench::do_not_optimize(container);
+        });
+        bench::report(name + " push_back", size, push_back, size);
+
+        Container container;
+        auto insert = bench::measure_ns_with_setup([&] {
+            container.clear();
+            fill_back(container, values);
+        }, [&] {
+            for (std::size_t i = 0; i < middle_ops; ++i) {
+                container.insert(container.begin() + static_cast<std::ptrdiff_t>(container.size() / 2), values[i]);
+            }
+        });
+        bench::report(name + " insert middle", size, insert, middle_ops);
+
+        auto erase = bench::measure_ns_with_setup([&] {
+            container.clear();
+            fill_back(container, values);
+        }, [&] {
+            for (std::size_t i = 0; i < middle_ops && !container.empty(); ++i) {
+                container.erase(container.begin() + static_cast<std::ptrdiff_t>(container.size() / 2));
+            }
+        });
+        bench::report(name + " erase middle", size, erase, middle_ops);
+
+        bench_common<Container>(name, values);
+    }
+
+    template<typename Container, typename T>
+    void bench_list(const std::string &name, const std::vector<T> &values) {
+        const std::size_t size = values.size();
+        auto push_back = bench::measure_ns([&] {
+            Container container;
+            fill_back(container, values);
+            bench::do_not_optimize(container);
+        });
+        bench::report(name + " push_back", size, push_back, size);
+
+        auto push_front = bench::measure_ns([&] {
+            Container container;
+            for (const auto &value : values) {
+                container.push_front(value);
+            }
+            bench::do_not_optimize(container);
+        });
+        bench::report(name + " push_front", size, push_front, size);
+
+        Container container;
+        auto insert = bench::measure_ns_with_setup([&] {
+            container.clear();
+            fill_back(container, values);
+        }, [&] {
+            auto middle = advanced(container.begin(), size / 2);
+            for (std::size_t i = 0; i < middle_ops; ++i) {
+                middle = container.insert(middle, values[i]);
+            }
+        });
+        bench::report(name + " insert middle", size, insert, middle_ops);
+
+        auto erase = bench::measure_ns_with_setup([&] {
+            container.clear();
+            fill_back(container, values);
+        }, [&] {
+            auto middle = advanced(container.begin(), size / 2);
+            for (std::size_t i = 0; i < middle_ops && middle != container.end(); ++i) {
+                middle = container.erase(middle);
+            }
+        });
+        bench::report(name + " erase middle", size, erase, middle_ops);
+
+        bench_common<Container>(name, values);
+    }
+
+    template<typename Container, typename T>
+    void bench_forward_list(const std::string &name, const std::vector<T> &values) {
+        const std::size_t size = values.size();
+        auto push_back = bench::measure_ns([&] {
+            Container container;
+            fill_back(container, values);
+            bench::do_not_optimize(container);
+        });
+        bench::report(name + " push_back", size, push_back, size);
+
+        auto push_front = bench::measure_ns([&] {
+            Container container;
+            for (const auto &value : values) {
+                container.push_front(value);
+            }
+            bench::do_not_optimize(container);
+        });
+        bench::report(name + " push_front", size, push_front, size);
+
+        Container container;
+        auto insert = bench::measure_ns_with_setup([&] {
+            container.clear();
+            fill_back(container, values);
+        }, [&] {
+            auto middle = advanced(container.begin(), size / 2);
+            for (std::size_t i = 0; i < middle_ops; ++i) {
+                middle = container.insert_after(middle, values[i]);
+            }
+        });
+        bench::report(name + " insert_after middle", size, insert, middle_ops);
+
+        auto erase = bench::measure_ns_with_setup([&] {
+            container.clear();
+            fill_back(container, values);
+        }, [&] {
+            auto middle = advanced(container.begin(), size / 2);
+            for (std::size_t i = 0; i < middle_ops; ++i) {
+                container.erase_after(middle);
+            }
+        });
+        bench::report(name + " erase_after middle", size, erase, middle_ops);
+
+        bench_common<Container>(name, values);
+    }
+
+    template<typename T>
+    void bench_type(const std::string &type, std::size_t size) {
+        const auto values = make_values<T>(size);
+        bench_vector<container::Vector<T>>("Vector<" + type + ">", values);
+        bench_vector<std::vector<T>>("std::vector<" + type + ">", values);
+        bench_list<container::List<T>>("List<" + type + ">", values);
+        bench_list<std::list<T>>("std::list<" + type + ">", values);
+        bench_forward_list<container::Forward_list<T>>("Forward_list<" + type + ">", values);
+        bench_forward_list<std::forward_list<T>>("std::forward_list<" + type + ">", values);
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    bench::Session session{argc, argv};
+    for (std::size_t size : {1'000u, 10'000u, 100'000u}) {
+        bench_type<int>("int", size);
+        bench_type<std::string>("std::string", size);
+        bench_type<Pod64>("Pod64", size);
+    }
+    return 0;
+}
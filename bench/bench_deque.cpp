@@ -0,0 +1,88 @@
+#include <deque>
+#include "Bench.hpp"
+#include "Deque.hpp"
+#include "Vector.hpp"
+
+// Deque pushes at both ends without moving elements. std::deque is the
+// reference, Vector::insert(begin()) is what pushing at the front costs
+// without it.
+
+namespace {
+    template<typename Container>
+    void bench_deque(const std::string &name, std::size_t size) {
+        auto push_back = bench::measure_ns([&] {
+            Container container;
+            for (std::size_t i = 0; i < size; ++i) {
+                container.push_back(static_cast<int>(i));
+            }
+            bench::do_not_optimize(container);
+        }, 3);
+        bench::report(name + " push_back", size, push_back, size);
+
+        auto push_front = bench::measure_ns([&] {
+            Container container;
+            for (std::size_t i = 0; i < size; ++i) {
+                container.push_front(static_cast<int>(i));
+            }
+            bench::do_not_optimize(container);
+        }, 3);
+        bench::report(name + " push_front", size, push_front, size);
+
+        Container container;
+        for (std::size_t i = 0; i < size; ++i) {
+            container.push_back(static_cast<int>(i));
+        }
+        auto index = bench::measure_ns([&] {
+            long long sum = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                sum += container[i];
+            }
+            bench::do_not_optimize(sum);
+        });
+        bench::report(name + " operator[]", size, index, size);
+
+        auto iterate = bench::measure_ns([&] {
+            long long sum = 0;
+            for (const auto &value : container) {
+                sum += value;
+            }
+            bench::do_not_optimize(sum);
+        });
+        bench::report(name + " iterate", size, iterate, size);
+
+        auto pop = bench::measure_ns_with_setup([&] {
+            container.clear();
+            for (std::size_t i = 0; i < size; ++i) {
+                container.push_back(static_cast<int>(i));
+            }
+        }, [&] {
+            while (!container.empty()) {
+                container.pop_front();
+            }
+        });
+        bench::report(name + " pop_front", size, pop, size);
+    }
+
+    void bench_vector_front(std::size_t size) {
+        auto insert = bench::measure_ns([&] {
+            container::Vector<int> vector;
+            for (std::size_t i = 0; i < size; ++i) {
+                vector.insert(vector.begin(), static_cast<int>(i));
+            }
+            bench::do_not_optimize(vector);
+        }, 1);
+        bench::report("Vector<int> insert(begin())", size, insert, size);
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    bench::Session session{argc, argv};
+    for (std::size_t size : {10'000u, 100'000u, 1'000'000u}) {
+        bench_deque<container::Deque<int>>("Deque<int>", size);
+        bench_deque<std::deque<int>>("std::deque<int>", size);
+        if (size <= 100'000u) {
+            bench_vector_front(size);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "Bench.hpp"
+#include "Vector.hpp"
+#include "List.hpp"
+
+// Text dumps of a container: the stringstream loop toString used to run
+// against toString, format_to into a reused Text_buffer, and operator<< into
+// a file, for Vector<int>, Vector<double> and List<int>. A Summary dump of the
+// first and last 8 elements shows what an audit log pays for a large container.
+// The size column is the number of elements.
+
+namespace {
+    const char *path = "bench_format.txt";
+
+    template<typename Container>
+    std::string stringstream_dump(const Container &container, const std::string &name) {
+        std::stringstream stream;
+        stream << "\n<===== Vector: " << name << " ======>\n >>Size:" << container.size();
+        std::size_t index = 0;
+        for (const auto &it : container) {
+            stream << "\n [" << index << "]=> " << it;
+            index++;
+        }
+        stream << "\n<=== End " << name << " ====>\n";
+        return stream.str();
+    }
+
+    template<typename Container>
+    void bench_container(const std::string &name, const Container &container, std::size_t size) {
+        auto old_dump = bench::measure_ns([&] {
+            bench::do_not_optimize(stringstream_dump(container, "bench"));
+        }, 3);
+        bench::report(name + " stringstream dump", size, old_dump, size);
+
+        auto dump = bench::measure_ns([&] {
+            bench::do_not_optimize(container.toString("bench"));
+        }, 3);
+        bench::report(name + " toString", size, dump, size);
+
+        container::Text_buffer buffer;
+        auto reused = bench::measure_ns([&] {
+            buffer.clear();
+            container.format_to(buffer, "bench");
+            bench::do_not_optimize(buffer.view().data());
+        }, 3);
+        bench::report(name + " format_to reused buffer", size, reused, size);
+
+        auto summary = bench::measure_ns([&] {
+            bench::do_not_optimize(container.toString("bench", container::Summary{8, 8}));
+        }, 3);
+        bench::report(name + " toString first/last 8", size, summary, size);
+
+        auto stream = bench::measure_ns([&] {
+            std::ofstream out(path);
+            out << container;
+        }, 3);
+        bench::report(name + " operator<< to file", size, stream, size);
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    bench::Session session{argc, argv};
+    for (std::size_t size : {10'000u, 1'000'000u}) {
+        container::Vector<int> ints;
+        container::Vector<double> doubles;
+        container::List<int> list;
+        for (std::size_t i = 0; i < size; ++i) {
+            ints.push_back(static_cast<int>(i * 7919));
+            doubles.push_back(static_cast<double>(i) / 3.0);
+            list.push_back(static_cast<int>(i));
+        }
+        bench_container("Vector<int>", ints, size);
+        bench_container("Vector<double>", doubles, size);
+        bench_container("List<int>", list, size);
+    }
+    std::remove(path);
+    return 0;
+}
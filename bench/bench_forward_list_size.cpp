@@ -0,0 +1,67 @@
+#include <forward_list>
+#include <iterator>
+#include "Bench.hpp"
+#include "Forward_list.hpp"
+
+// Forward_list keeps its element count and last node: size() and push_back
+// no longer walk the list. The walk lines time the traversal both used to
+// do on every call, std::forward_list has neither operation.
+
+namespace {
+    void bench_forward_list(std::size_t size) {
+        container::Forward_list<int> list;
+        auto build = bench::measure_ns([&] {
+            list.clear();
+            for (std::size_t i = 0; i < size; ++i) {
+                list.push_back(static_cast<int>(i));
+            }
+            bench::do_not_optimize(list);
+        }, 3);
+        bench::report("Forward_list push_back", size, build, size);
+
+        std::forward_list<int> std_list;
+        auto std_build = bench::measure_ns([&] {
+            std_list.clear();
+            auto last = std_list.before_begin();
+            for (std::size_t i = 0; i < size; ++i) {
+                last = std_list.insert_after(last, static_cast<int>(i));
+            }
+            bench::do_not_optimize(std_list);
+        }, 3);
+        bench::report("std::forward_list insert_after(last)", size, std_build, size);
+
+        constexpr std::size_t calls = 1'000'000;
+        auto cached = bench::measure_ns([&] {
+            std::size_t sum = 0;
+            for (std::size_t i = 0; i < calls; ++i) {
+                bench::do_not_optimize(list);
+                sum += list.size();
+            }
+            bench::do_not_optimize(sum);
+        });
+        bench::report("Forward_list size()", size, cached, calls);
+
+        auto walk = bench::measure_ns([&] {
+            std::size_t count = 0;
+            for (auto it = list.begin(); it != list.end(); ++it) {
+                ++count;
+            }
+            bench::do_not_optimize(count);
+        }, 3);
+        bench::report("Forward_list walk to end (old size/push_back)", size, walk, 1);
+
+        auto std_walk = bench::measure_ns([&] {
+            auto count = std::distance(std_list.begin(), std_list.end());
+            bench::do_not_optimize(count);
+        }, 3);
+        bench::report("std::forward_list std::distance", size, std_walk, 1);
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    bench::Session session{argc, argv};
+    for (std::size_t size : {100'000u, 1'000'000u, 10'000'000u}) {
+        bench_forward_list(size);
+    }
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include <iomanip>
+#include <memory>
+#include "Bench.hpp"
+#include "Vector.hpp"
+
+// Growth policies of Vector: reallocation count, peak memory held by the
+// vector and push_back throughput while filling it from empty.
+
+namespace {
+    struct Allocation_stats {
+        std::size_t allocations = 0;
+        std::size_t bytes = 0;
+        std::size_t peak_bytes = 0;
+    };
+
+    Allocation_stats stats;
+
+    template<typename T>
+    struct Counting_allocator {
+        using value_type = T;
+
+        Counting_allocator() = default;
+        template<typename U>
+        Counting_allocator(const Counting_allocator<U> &) noexcept {}
+
+        T *allocate(std::size_t count) {
+            ++stats.allocations;
+            stats.bytes += count * sizeof(T);
+            if (stats.bytes > stats.peak_bytes) {
+                stats.peak_bytes = stats.bytes;
+            }
+            return std::allocator<T>{}.allocate(count);
+        }
+
+        void deallocate(T *data, std::size_t count) noexcept {
+            stats.bytes -= count * sizeof(T);
+            std::allocator<T>{}.deallocate(data, count);
+        }
+
+        template<typename U>
+        bool operator==(const Counting_allocator<U> &) const noexcept { return true; }
+        template<typename U>
+        bool operator!=(const Counting_allocator<U> &) const noexcept { return false; }
+    };
+
+    template<typename Growth>
+    void bench_policy(const std::string &name, std::size_t size) {
+        using Vector_type = container::Vector<int, Counting_allocator<int>, Growth>;
+
+        stats = Allocation_stats{};
+        {
+            Vector_type vector;
+            for (std::size_t i = 0; i < size; ++i) {
+                vector.push_back(static_cast<int>(i));
+            }
+        }
+        const auto counted = stats;
+
+        auto total = bench::measure_ns([&] {
+            Vector_type vector;
+            for (std::size_t i = 0; i < size; ++i) {
+                vector.push_back(static_cast<int>(i));
+            }
+            bench::do_not_optimize(vector);
+        }, 3);
+
+        bench::report(name + " push_back", size, total, size);
+        std::cout << std::setw(52) << "" << std::right
+                  << std::setw(10) << (counted.allocations ? counted.allocations - 1 : 0) << " reallocations, peak "
+                  << counted.peak_bytes / 1024 << " KiB for " << size * sizeof(int) / 1024 << " KiB of data\n";
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    bench::Session session{argc, argv};
+    for (std::size_t size : {1'000u, 100'000u, 1'000'000u}) {
+        bench_policy<container::Doubling_growth>("Doubling_growth", size);
+        bench_policy<container::Half_growth>("Half_growth", size);
+        bench_policy<container::Page_growth<>>("Page_growth<4096>", size);
+        bench_policy<container::Page_growth<1 << 20>>("Page_growth<1 MiB>", size);
+        bench_policy<container::Fixed_capacity<1'000'000>>("Fixed_capacity<1000000>", size);
+    }
+    return 0;
+}
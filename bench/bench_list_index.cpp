@@ -0,0 +1,72 @@
+#include <iterator>
+#include <list>
+#include "Bench.hpp"
+#include "List.hpp"
+
+// Indexed access on List walks from the finger left by the previous access:
+// a sequential operator[] scan and repeated push_mid become linear. The
+// std::list lines walk from the nearest end on every call, as List::seek
+// used to, and stay quadratic.
+
+namespace {
+    template<typename T>
+    typename std::list<T>::iterator seek(std::list<T> &list, std::size_t index) {
+        if (index < list.size() / 2) {
+            return std::next(list.begin(), static_cast<std::ptrdiff_t>(index));
+        }
+        return std::prev(list.end(), static_cast<std::ptrdiff_t>(list.size() - index));
+    }
+
+    void bench_index(std::size_t size) {
+        container::List<int> list;
+        std::list<int> std_list;
+        for (std::size_t i = 0; i < size; ++i) {
+            list.push_back(static_cast<int>(i));
+            std_list.push_back(static_cast<int>(i));
+        }
+
+        auto scan = bench::measure_ns([&] {
+            long long sum = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                sum += list[i];
+            }
+            bench::do_not_optimize(sum);
+        }, 3);
+        bench::report("List operator[] scan", size, scan, size);
+
+        auto std_scan = bench::measure_ns([&] {
+            long long sum = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                sum += *seek(std_list, i);
+            }
+            bench::do_not_optimize(sum);
+        }, 1);
+        bench::report("std::list walk from nearest end scan", size, std_scan, size);
+
+        auto push_mid = bench::measure_ns([&] {
+            container::List<int> mid_list;
+            for (std::size_t i = 0; i < size; ++i) {
+                mid_list.push_mid(static_cast<int>(i));
+            }
+            bench::do_not_optimize(mid_list);
+        }, 3);
+        bench::report("List push_mid", size, push_mid, size);
+
+        auto std_push_mid = bench::measure_ns([&] {
+            std::list<int> mid_list;
+            for (std::size_t i = 0; i < size; ++i) {
+                mid_list.insert(mid_list.empty() ? mid_list.end() : seek(mid_list, mid_list.size() / 2), static_cast<int>(i));
+            }
+            bench::do_not_optimize(mid_list);
+        }, 1);
+        bench::report("std::list insert at walked middle", size, std_push_mid, size);
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    bench::Session session{argc, argv};
+    for (std::size_t size : {1'000u, 10'000u, 30'000u}) {
+        bench_index(size);
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <cstdio>
+#include <fstream>
+#include "Bench.hpp"
+#include "MappedVector.hpp"
+#include "Vector.hpp"
+
+// Startup of a table of records kept on disk: rebuilding a Vector by reading
+// the file element by element against opening a MappedVector over it, then a
+// scan of every record to include the cost of faulting the pages in. Appending
+// and flushing are measured too. The size column is the number of records; the
+// files live in the working directory and are removed afterwards.
+
+namespace {
+    struct Record {
+        long long key;
+        double values[7];
+    };
+
+    void bench_startup(std::size_t size) {
+        const std::string stream_path = "bench_mapped_vector_stream.bin";
+        const std::string mapped_path = "bench_mapped_vector_mapped.bin";
+        std::remove(stream_path.c_str());
+        std::remove(mapped_path.c_str());
+        {
+            std::ofstream out(stream_path, std::ios::binary);
+            container::MappedVector<Record> mapped(mapped_path);
+            for (std::size_t i = 0; i < size; ++i) {
+                Record record{static_cast<long long>(i), {}};
+                out.write(reinterpret_cast<const char *>(&record), sizeof(record));
+                mapped.push_back(record);
+            }
+            mapped.flush();
+        }
+
+        auto load = bench::measure_ns([&] {
+            std::ifstream in(stream_path, std::ios::binary);
+            container::Vector<Record> records;
+            Record record;
+            while (in.read(reinterpret_cast<char *>(&record), sizeof(record))) {
+                records.push_back(record);
+            }
+            bench::do_not_optimize(records);
+        }, 3);
+        bench::report("Vector rebuilt from file", size, load, size);
+
+        auto open = bench::measure_ns([&] {
+            container::MappedVector<Record> records(mapped_path);
+            bench::do_not_optimize(records.size());
+        }, 3);
+        bench::report("MappedVector open", size, open, size);
+
+        auto open_scan = bench::measure_ns([&] {
+            container::MappedVector<Record> records(mapped_path);
+            long long sum = 0;
+            for (const auto &record : records) {
+                sum += record.key;
+            }
+            bench::do_not_optimize(sum);
+        }, 3);
+        bench::report("MappedVector open + scan", size, open_scan, size);
+
+        std::remove(mapped_path.c_str());
+        auto append = bench::measure_ns_with_setup([&] {
+            std::remove(mapped_path.c_str());
+        }, [&] {
+            container::MappedVector<Record> records(mapped_path);
+            for (std::size_t i = 0; i < size; ++i) {
+                records.push_back(Record{static_cast<long long>(i), {}});
+            }
+            records.flush();
+        }, 3);
+        bench::report("MappedVector::push_back + flush", size, append, size);
+
+        std::remove(stream_path.c_str());
+        std::remove(mapped_path.c_str());
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    bench::Session session{argc, argv};
+    for (std::size_t size : {10'000u, 1'000'000u}) {
+        bench_startup(size);
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include <cstdlib>
+#include <memory>
+#include <vector>
+#include "Bench.hpp"
+#include "List.hpp"
+#include "Forward_list.hpp"
+#include "Node_pool.hpp"
+
+// Node pool against the default allocator for List and Forward_list:
+// insert/erase churn throughput and traversal of a list whose nodes were
+// allocated while the heap was being fragmented by unrelated allocations.
+
+namespace {
+    // Interleaves every node allocation with unrelated heap traffic
+    class Heap_noise {
+    public:
+        ~Heap_noise() {
+            for (auto block : m_blocks) {
+                std::free(block);
+            }
+        }
+        void step() {
+            m_blocks.push_back(std::malloc(16 + (m_blocks.size() * 7919) % 240));
+        }
+    private:
+        std::vector<void *> m_blocks;
+    };
+
+    template<typename List_type>
+    void bench_list(const std::string &name, std::size_t size) {
+        List_type list;
+        {
+            Heap_noise noise;
+            for (std::size_t i = 0; i < size; ++i) {
+                list.push_back(static_cast<int>(i));
+                noise.step();
+            }
+        }
+
+        auto churn = bench::measure_ns([&] {
+            for (std::size_t i = 0; i < size; ++i) {
+                list.pop_front();
+                list.push_back(static_cast<int>(i));
+            }
+        });
+        bench::report(name + " pop_front+push_back", size, churn, 2 * size);
+
+        auto traverse = bench::measure_ns([&] {
+            long long sum = 0;
+            for (const auto &value : list) {
+                sum += value;
+            }
+            bench::do_not_optimize(sum);
+        });
+        bench::report(name + " traverse", size, traverse, size);
+
+        auto clear = bench::measure_ns([&] {
+            List_type temp;
+            for (std::size_t i = 0; i < size; ++i) {
+                temp.push_back(static_cast<int>(i));
+            }
+            temp.clear();
+        }, 3);
+        bench::report(name + " build+clear", size, clear, size);
+    }
+
+    template<typename List_type>
+    void bench_forward_list(const std::string &name, std::size_t size) {
+        List_type list;
+        {
+            Heap_noise noise;
+            for (std::size_t i = 0; i < size; ++i) {
+                list.push_front(static_cast<int>(i));
+                noise.step();
+            }
+        }
+
+        auto churn = bench::measure_ns([&] {
+            for (std::size_t i = 0; i < size; ++i) {
+                list.pop_front();
+                list.push_front(static_cast<int>(i));
+            }
+        });
+        bench::report(name + " pop_front+push_front", size, churn, 2 * size);
+
+        auto traverse = bench::measure_ns([&] {
+            long long sum = 0;
+            for (const auto &value : list) {
+                sum += value;
+            }
+            bench::do_not_optimize(sum);
+        });
+        bench::report(name + " traverse", size, traverse, size);
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    bench::Session session{argc, argv};
+    for (std::size_t size : {10'000u, 100'000u, 1'000'000u}) {
+        bench_list<container::List<int>>("List<int>", size);
+        bench_list<container::List<int, container::Pool_allocator<int>>>("List<int, Pool_allocator>", size);
+        bench_forward_list<container::Forward_list<int>>("Forward_list<int>", size);
+        bench_forward_list<container::Forward_list<int, container::Pool_allocator<int>>>("Forward_list<int, Pool_allocator>", size);
+    }
+    return 0;
+}
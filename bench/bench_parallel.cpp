@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include "Bench.hpp"
+#include "Parallel.hpp"
+
+// The parallel algorithms against the sequential std algorithm over the same
+// Vector data, on the default pool (one thread per core). The size column is
+// the number of elements.
+
+namespace {
+    container::Vector<double> make_values(std::size_t size) {
+        std::mt19937_64 rng(42);
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        container::Vector<double> values;
+        values.reserve(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            values.push_back(dist(rng));
+        }
+        return values;
+    }
+
+    void bench_algorithms(std::size_t size) {
+        namespace parallel = container::parallel;
+        const std::string threads = " (" + std::to_string(parallel::default_pool().concurrency()) + " threads)";
+        auto values = make_values(size);
+        const double *data = values.data();
+
+        auto sum = bench::measure_ns([&] {
+            bench::do_not_optimize(std::accumulate(data, data + size, 0.0));
+        });
+        bench::report("std::accumulate", size, sum, size);
+        auto parallel_sum = bench::measure_ns([&] {
+            bench::do_not_optimize(parallel::reduce(values, 0.0));
+        });
+        bench::report("parallel::reduce" + threads, size, parallel_sum, size);
+
+        auto count = bench::measure_ns([&] {
+            bench::do_not_optimize(std::count_if(data, data + size, [](double x) { return x < 0.25; }));
+        });
+        bench::report("std::count_if", size, count, size);
+        auto parallel_count = bench::measure_ns([&] {
+            bench::do_not_optimize(parallel::count_if(values, [](double x) { return x < 0.25; }));
+        });
+        bench::report("parallel::count_if" + threads, size, parallel_count, size);
+
+        auto find = bench::measure_ns([&] {
+            bench::do_not_optimize(std::find_if(data, data + size, [](double x) { return x > 2.0; }));
+        });
+        bench::report("std::find_if (no match)", size, find, size);
+        auto parallel_find = bench::measure_ns([&] {
+            bench::do_not_optimize(parallel::find_if(values, [](double x) { return x > 2.0; }));
+        });
+        bench::report("parallel::find_if (no match)" + threads, size, parallel_find, size);
+
+        container::Vector<double> out;
+        parallel::transform(values, out, [](double x) { return x; });
+        auto transform = bench::measure_ns([&] {
+            std::transform(data, data + size, out.data(), [](double x) { return x * x + 1.0; });
+            bench::do_not_optimize(out);
+        });
+        bench::report("std::transform", size, transform, size);
+        auto parallel_transform = bench::measure_ns([&] {
+            parallel::transform(values, out, [](double x) { return x * x + 1.0; });
+            bench::do_not_optimize(out);
+        });
+        bench::report("parallel::transform" + threads, size, parallel_transform, size);
+
+        container::Vector<double> unsorted;
+        auto sort = bench::measure_ns_with_setup([&] {
+            unsorted = values;
+        }, [&] {
+            std::sort(unsorted.data(), unsorted.data() + size);
+        }, 3);
+        bench::report("std::sort", size, sort, size);
+        auto parallel_sort = bench::measure_ns_with_setup([&] {
+            unsorted = values;
+        }, [&] {
+            parallel::sort(unsorted);
+        }, 3);
+        bench::report("parallel::sort" + threads, size, parallel_sort, size);
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    bench::Session session{argc, argv};
+    for (std::size_t size : {100'000u, 1'000'000u, 10'000'000u}) {
+        bench_algorithms(size);
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <cstdio>
+#include <fstream>
+#include <fcntl.h>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "Bench.hpp"
+#include "Serialization.hpp"
+
+// Snapshot of a container to a file and back: the text of operator<< against
+// the binary format, for Vector<double> (one bulk copy), Vector<std::string>
+// and List<int> (element by element). The file lives in the working directory
+// and is removed afterwards. The size column is the number of elements.
+
+namespace {
+    const char *path = "bench_serialization.bin";
+
+    template<typename Container>
+    void bench_container(const std::string &name, const Container &container, std::size_t size) {
+        auto text = bench::measure_ns([&] {
+            std::ofstream out(path);
+            out << container;
+        }, 3);
+        bench::report(name + " operator<< to file", size, text, size);
+
+        auto write = bench::measure_ns([&] {
+            int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            {
+                container::Binary_writer writer(fd);
+                container::serialize(writer, container);
+                writer.flush();
+            }
+            ::close(fd);
+        }, 3);
+        bench::report(name + " serialize to file", size, write, size);
+
+        auto read = bench::measure_ns([&] {
+            int fd = ::open(path, O_RDONLY);
+            Container loaded;
+            {
+                container::Binary_reader reader(fd);
+                container::deserialize(reader, loaded);
+            }
+            ::close(fd);
+            bench::do_not_optimize(loaded);
+        }, 3);
+        bench::report(name + " deserialize from file", size, read, size);
+    }
+
+    void bench_view(std::size_t size) {
+        std::vector<double> buffer(size + 4);
+        FILE *file = std::fopen(path, "rb");
+        const std::size_t bytes = std::fread(buffer.data(), 1, buffer.size() * sizeof(double), file);
+        std::fclose(file);
+        auto view = bench::measure_ns([&] {
+            container::Vector_view<double> doubles(buffer.data(), bytes);
+            bench::do_not_optimize(doubles.data());
+        });
+        bench::report("Vector_view<double> over loaded buffer", size, view, size);
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    bench::Session session{argc, argv};
+    for (std::size_t size : {10'000u, 1'000'000u}) {
+        container::Vector<double> doubles;
+        container::Vector<std::string> strings;
+        container::List<int> list;
+        for (std::size_t i = 0; i < size; ++i) {
+            doubles.push_back(static_cast<double>(i) * 0.25);
+            strings.push_back("element " + std::to_string(i));
+            list.push_back(static_cast<int>(i));
+        }
+        bench_container("Vector<double>", doubles, size);
+        bench_view(size);
+        bench_container("Vector<std::string>", strings, size);
+        bench_container("List<int>", list, size);
+    }
+    std::remove(path);
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include "Bench.hpp"
+#include "Vector.hpp"
+
+// The Vector searches, fill and equality, which run the kernels of Simd.hpp,
+// against the scalar loops of the std algorithms over the same data. The
+// searched value is absent, so every element is looked at.
+
+namespace {
+    template<typename T>
+    const T *scalar_find(const T *first, const T *last, T value) {
+        for (; first != last; ++first) {
+            if (*first == value) {
+                return first;
+            }
+        }
+        return last;
+    }
+
+    template<typename T>
+    void bench_type(const std::string &type, std::size_t size) {
+        container::Vector<T> vector;
+        vector.reserve(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            vector.push_back(static_cast<T>(i % 100));
+        }
+        const container::Vector<T> copy = vector;
+        const T *first = vector.data();
+        const T *last = first + size;
+        const T absent = static_cast<T>(101);
+
+        auto find = bench::measure_ns([&] { bench::do_not_optimize(scalar_find(first, last, absent)); });
+        bench::report("scalar find<" + type + ">", size, find, size);
+        auto simd_find = bench::measure_ns([&] { bench::do_not_optimize(vector.find(absent)); });
+        bench::report("Vector::find<" + type + ">", size, simd_find, size);
+
+        auto count = bench::measure_ns([&] { bench::do_not_optimize(std::count(first, last, static_cast<T>(7))); });
+        bench::report("std::count<" + type + ">", size, count, size);
+        auto simd_count = bench::measure_ns([&] { bench::do_not_optimize(vector.count(static_cast<T>(7))); });
+        bench::report("Vector::count<" + type + ">", size, simd_count, size);
+
+        auto min = bench::measure_ns([&] { bench::do_not_optimize(std::min_element(first, last)); });
+        bench::report("std::min_element<" + type + ">", size, min, size);
+        auto simd_min = bench::measure_ns([&] { bench::do_not_optimize(vector.min_element()); });
+        bench::report("Vector::min_element<" + type + ">", size, simd_min, size);
+
+        auto max = bench::measure_ns([&] { bench::do_not_optimize(std::max_element(first, last)); });
+        bench::report("std::max_element<" + type + ">", size, max, size);
+        auto simd_max = bench::measure_ns([&] { bench::do_not_optimize(vector.max_element()); });
+        bench::report("Vector::max_element<" + type + ">", size, simd_max, size);
+
+        auto equal = bench::measure_ns([&] { bench::do_not_optimize(std::equal(first, last, copy.data())); });
+        bench::report("std::equal<" + type + ">", size, equal, size);
+        auto simd_equal = bench::measure_ns([&] { bench::do_not_optimize(vector == copy); });
+        bench::report("Vector::operator==<" + type + ">", size, simd_equal, size);
+
+        auto fill = bench::measure_ns([&] {
+            std::fill(vector.data(), vector.data() + size, static_cast<T>(3));
+            bench::do_not_optimize(vector);
+        });
+        bench::report("std::fill<" + type + ">", size, fill, size);
+        auto simd_fill = bench::measure_ns([&] {
+            vector.fill(static_cast<T>(3));
+            bench::do_not_optimize(vector);
+        });
+        bench::report("Vector::fill<" + type + ">", size, simd_fill, size);
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    bench::Session session{argc, argv};
+    for (std::size_t size : {1'000u, 100'000u, 10'000'000u}) {
+        bench_type<std::int8_t>("int8_t", size);
+        bench_type<int>("int", size);
+        bench_type<float>("float", size);
+        bench_type<double>("double", size);
+    }
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include <cstdint>
+#include "Bench.hpp"
+#include "SoaVector.hpp"
+#include "Vector.hpp"
+
+// A ten-field record kept as Vector<Trade> against the same fields in a
+// SoaVector: appending records, a scan of one field, a scan of two fields
+// and a full copy. The size column is the number of records.
+
+namespace {
+    struct Trade {
+        std::int64_t id;
+        std::int64_t timestamp;
+        double price;
+        double quantity;
+        std::int32_t venue;
+        std::int32_t side;
+        double fee;
+        std::int64_t account;
+        std::int64_t order;
+        double notional;
+    };
+
+    using Trades = container::SoaVector<std::int64_t, std::int64_t, double, double, std::int32_t,
+                                        std::int32_t, double, std::int64_t, std::int64_t, double>;
+
+    Trade make_trade(std::size_t i) {
+        const auto n = static_cast<std::int64_t>(i);
+        return Trade{n, n * 1000, 100.0 + static_cast<double>(i % 50), static_cast<double>(i % 7 + 1),
+                     static_cast<std::int32_t>(i % 12), static_cast<std::int32_t>(i % 2), 0.01,
+                     n % 100, n * 3, 0.0};
+    }
+
+    void append(Trades &trades, const Trade &t) {
+        trades.emplace_back(t.id, t.timestamp, t.price, t.quantity, t.venue, t.side, t.fee, t.account, t.order, t.notional);
+    }
+
+    void bench_records(std::size_t size) {
+        container::Vector<Trade> records;
+        Trades columns;
+        auto push_records = bench::measure_ns_with_setup([&] {
+            records = container::Vector<Trade>();
+        }, [&] {
+            for (std::size_t i = 0; i < size; ++i) {
+                records.push_back(make_trade(i));
+            }
+        });
+        bench::report("Vector<Trade>::push_back", size, push_records, size);
+        auto push_columns = bench::measure_ns_with_setup([&] {
+            columns = Trades();
+        }, [&] {
+            for (std::size_t i = 0; i < size; ++i) {
+                append(columns, make_trade(i));
+            }
+        });
+        bench::report("SoaVector::emplace_back", size, push_columns, size);
+
+        auto scan_records = bench::measure_ns([&] {
+            double sum = 0;
+            for (const auto &trade : records) {
+                sum += trade.price;
+            }
+            bench::do_not_optimize(sum);
+        });
+        bench::report("Vector<Trade> sum of price", size, scan_records, size);
+        auto scan_columns = bench::measure_ns([&] {
+            double sum = 0;
+            for (double price : columns.column<2>()) {
+                sum += price;
+            }
+            bench::do_not_optimize(sum);
+        });
+        bench::report("SoaVector sum of price column", size, scan_columns, size);
+
+        auto notional_records = bench::measure_ns([&] {
+            for (auto &trade : records) {
+                trade.notional = trade.price * trade.quantity;
+            }
+            bench::do_not_optimize(records);
+        });
+        bench::report("Vector<Trade> notional = price * quantity", size, notional_records, size);
+        auto notional_columns = bench::measure_ns([&] {
+            auto price = columns.column<2>();
+            auto quantity = columns.column<3>();
+            auto notional = columns.column<9>();
+            for (std::size_t i = 0; i < notional.size(); ++i) {
+                notional[i] = price[i] * quantity[i];
+            }
+            bench::do_not_optimize(columns);
+        });
+        bench::report("SoaVector notional = price * quantity", size, notional_columns, size);
+
+        auto copy_records = bench::measure_ns([&] {
+            container::Vector<Trade> copy = records;
+            bench::do_not_optimize(copy);
+        });
+        bench::report("Vector<Trade> copy", size, copy_records, size);
+        auto copy_columns = bench::measure_ns([&] {
+            Trades copy = columns;
+            bench::do_not_optimize(copy);
+        });
+        bench::report("SoaVector copy", size, copy_columns, size);
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    bench::Session session{argc, argv};
+    for (std::size_t size : {1'000u, 100'000u, 1'000'000u}) {
+        bench_records(size);
+    }
+    return 0;
+}
@@ -0,0 +1,121 @@
+#include <mutex>
+#include <thread>
+#include "Bench.hpp"
+#include "SpscRing.hpp"
+#include "Vector.hpp"
+
+// Throughput of passing integers from a producer thread to a consumer thread:
+// SpscRing one element at a time and in batches, against a Vector guarded by
+// a mutex that the consumer empties by swapping it with its own. A side that
+// finds nothing to do yields, so the benchmark also finishes on a single core.
+
+namespace {
+    constexpr std::size_t batch = 64;
+
+    void bench_ring(std::size_t capacity, std::size_t count) {
+        auto single = bench::measure_ns([&] {
+            container::SpscRing<long> ring(capacity);
+            long sum = 0;
+            std::thread consumer([&] {
+                long value = 0;
+                for (std::size_t received = 0; received < count;) {
+                    if (ring.try_pop(value)) {
+                        sum += value;
+                        ++received;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+            for (std::size_t sent = 0; sent < count;) {
+                if (ring.try_push(static_cast<long>(sent))) {
+                    ++sent;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            consumer.join();
+            bench::do_not_optimize(sum);
+        }, 3);
+        bench::report("SpscRing<long> try_push/try_pop, capacity " + std::to_string(capacity), count, single, count);
+
+        auto batched = bench::measure_ns([&] {
+            container::SpscRing<long> ring(capacity);
+            long sum = 0;
+            std::thread consumer([&] {
+                long values[batch];
+                for (std::size_t received = 0; received < count;) {
+                    std::size_t popped = ring.pop_n(values, batch);
+                    if (popped == 0) {
+                        std::this_thread::yield();
+                    }
+                    for (std::size_t i = 0; i < popped; ++i) {
+                        sum += values[i];
+                    }
+                    received += popped;
+                }
+            });
+            long values[batch];
+            for (std::size_t sent = 0; sent < count;) {
+                std::size_t size = count - sent < batch ? count - sent : batch;
+                for (std::size_t i = 0; i < size; ++i) {
+                    values[i] = static_cast<long>(sent + i);
+                }
+                std::size_t pushed = 0;
+                while (pushed < size) {
+                    std::size_t added = ring.push_n(values + pushed, size - pushed);
+                    if (added == 0) {
+                        std::this_thread::yield();
+                    }
+                    pushed += added;
+                }
+                sent += size;
+            }
+            consumer.join();
+            bench::do_not_optimize(sum);
+        }, 3);
+        bench::report("SpscRing<long> push_n/pop_n, capacity " + std::to_string(capacity), count, batched, count);
+    }
+
+    void bench_mutex_vector(std::size_t count) {
+        auto locked = bench::measure_ns([&] {
+            std::mutex mutex;
+            container::Vector<long> shared;
+            long sum = 0;
+            std::thread consumer([&] {
+                container::Vector<long> taken;
+                for (std::size_t received = 0; received < count;) {
+                    {
+                        std::lock_guard<std::mutex> lock{mutex};
+                        taken.swap(shared);
+                    }
+                    for (std::size_t i = 0; i < taken.size(); ++i) {
+                        sum += taken[i];
+                    }
+                    received += taken.size();
+                    if (taken.empty()) {
+                        std::this_thread::yield();
+                    }
+                    taken.clear();
+                }
+            });
+            for (std::size_t sent = 0; sent < count; ++sent) {
+                std::lock_guard<std::mutex> lock{mutex};
+                shared.push_back(static_cast<long>(sent));
+            }
+            consumer.join();
+            bench::do_not_optimize(sum);
+        }, 3);
+        bench::report("mutex + Vector<long> push_back/swap", count, locked, count);
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    bench::Session session{argc, argv};
+    constexpr std::size_t count = 2'000'000;
+    for (std::size_t capacity : {256u, 4096u, 65536u}) {
+        bench_ring(capacity, count);
+    }
+    bench_mutex_vector(count);
+    return 0;
+}
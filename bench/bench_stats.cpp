@@ -0,0 +1,84 @@
+#define CONTAINER_STATS
+
+#include <list>
+#include <vector>
+#include "Bench.hpp"
+#include "Vector.hpp"
+#include "List.hpp"
+#include "Forward_list.hpp"
+
+// Cost of the CONTAINER_STATS counters: this program is built with them on,
+// so its Vector and List lines compare with the same workloads of
+// bench_containers, built with them off, and with the uninstrumented std
+// containers below. An update is a relaxed load and store into the counters
+// of the calling thread; a snapshot locks the registry and adds up every
+// thread's counters.
+
+namespace {
+    void bench_vector(std::size_t size) {
+        auto push = bench::measure_ns([&] {
+            container::Vector<int> vector;
+            for (std::size_t i = 0; i < size; ++i) {
+                vector.push_back(static_cast<int>(i));
+            }
+            bench::do_not_optimize(vector.data());
+        }, 3);
+        bench::report("Vector<int> push_back, stats on", size, push, size);
+
+        auto std_push = bench::measure_ns([&] {
+            std::vector<int> vector;
+            for (std::size_t i = 0; i < size; ++i) {
+                vector.push_back(static_cast<int>(i));
+            }
+            bench::do_not_optimize(vector.data());
+        }, 3);
+        bench::report("std::vector<int> push_back", size, std_push, size);
+    }
+
+    void bench_list(std::size_t size) {
+        container::List<int> list;
+        auto push = bench::measure_ns_with_setup([&] { list.clear(); }, [&] {
+            for (std::size_t i = 0; i < size; ++i) {
+                list.push_back(static_cast<int>(i));
+            }
+        }, 3);
+        bench::report("List<int> push_back, stats on", size, push, size);
+
+        std::list<int> std_list;
+        auto std_push = bench::measure_ns_with_setup([&] { std_list.clear(); }, [&] {
+            for (std::size_t i = 0; i < size; ++i) {
+                std_list.push_back(static_cast<int>(i));
+            }
+        }, 3);
+        bench::report("std::list<int> push_back", size, std_push, size);
+
+        auto scan = bench::measure_ns([&] {
+            long long sum = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                sum += list[i];
+            }
+            bench::do_not_optimize(sum);
+        }, 3);
+        bench::report("List operator[] scan, stats on", size, scan, size);
+    }
+
+    void bench_snapshot() {
+        constexpr std::size_t count = 100'000;
+        auto snapshot = bench::measure_ns([&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                bench::do_not_optimize(container::stats::snapshot<container::List<int>>());
+            }
+        });
+        bench::report("stats::snapshot<List<int>>", count, snapshot, count);
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    bench::Session session{argc, argv};
+    for (std::size_t size : {10'000u, 1'000'000u}) {
+        bench_vector(size);
+        bench_list(size);
+    }
+    bench_snapshot();
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include "Bench.hpp"
+#include "List.hpp"
+#include "UnrolledList.hpp"
+
+// UnrolledList keeps B elements per node: a traversal follows one pointer per
+// B elements and an insert in the middle shifts at most B elements inside a
+// node instead of allocating one. List is the one element per node baseline.
+
+namespace {
+    // inserts per measurement at an iterator in the middle
+    constexpr std::size_t middle_ops = 1'000;
+
+    template<typename Iterator>
+    Iterator advanced(Iterator it, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            ++it;
+        }
+        return it;
+    }
+
+    template<typename Container>
+    void bench_list(const std::string &name, std::size_t size) {
+        Container container;
+        auto build = bench::measure_ns([&] {
+            container.clear();
+            for (std::size_t i = 0; i < size; ++i) {
+                container.push_back(static_cast<int>(i));
+            }
+            bench::do_not_optimize(container);
+        }, 3);
+        bench::report(name + " push_back", size, build, size);
+
+        auto traverse = bench::measure_ns([&] {
+            long long sum = 0;
+            for (const auto &value : container) {
+                sum += value;
+            }
+            bench::do_not_optimize(sum);
+        });
+        bench::report(name + " traverse", size, traverse, size);
+
+        auto insert = bench::measure_ns_with_setup([&] {
+            container.clear();
+            for (std::size_t i = 0; i < size; ++i) {
+                container.push_back(static_cast<int>(i));
+            }
+        }, [&] {
+            auto middle = advanced(container.begin(), size / 2);
+            for (std::size_t i = 0; i < middle_ops; ++i) {
+                middle = container.insert(middle, static_cast<int>(i));
+            }
+        });
+        bench::report(name + " insert middle", size, insert, middle_ops);
+
+        auto push_mid = bench::measure_ns_with_setup([&] {
+            container.clear();
+            for (std::size_t i = 0; i < size; ++i) {
+                container.push_back(static_cast<int>(i));
+            }
+        }, [&] {
+            for (std::size_t i = 0; i < middle_ops; ++i) {
+                container.push_mid(static_cast<int>(i));
+            }
+        });
+        bench::report(name + " push_mid", size, push_mid, middle_ops);
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    bench::Session session{argc, argv};
+    for (std::size_t size : {10'000u, 100'000u, 1'000'000u}) {
+        bench_list<container::List<int>>("List<int>", size);
+        bench_list<container::UnrolledList<int, 16>>("UnrolledList<int, 16>", size);
+        bench_list<container::UnrolledList<int, 64>>("UnrolledList<int, 64>", size);
+    }
+    return 0;
+}
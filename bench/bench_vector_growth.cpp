@@ -0,0 +1,65 @@
+#include <string>
+#include <vector>
+#include "Bench.hpp"
+#include "Vector.hpp"
+
+// push_back throughput while the vector grows from empty: reallocation moves
+// std::string elements and relocates trivially copyable ones with memcpy.
+
+namespace {
+    struct Pod256 {
+        char bytes[256];
+    };
+
+    template<typename T>
+    T make(std::size_t i);
+
+    template<>
+    int make<int>(std::size_t i) {
+        return static_cast<int>(i);
+    }
+
+    template<>
+    std::string make<std::string>(std::size_t i) {
+        return "element number " + std::to_string(i) + " (heap allocated)";
+    }
+
+    template<>
+    Pod256 make<Pod256>(std::size_t i) {
+        Pod256 pod;
+        pod.bytes[0] = static_cast<char>(i);
+        return pod;
+    }
+
+    template<typename Vector_type>
+    void bench_push_back(const std::string &name, std::size_t size) {
+        using value_type = typename Vector_type::value_type;
+        std::vector<value_type> values;
+        values.reserve(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            values.push_back(make<value_type>(i));
+        }
+
+        auto total = bench::measure_ns([&] {
+            Vector_type vector;
+            for (const auto &value : values) {
+                vector.push_back(value);
+            }
+            bench::do_not_optimize(vector);
+        });
+        bench::report(name + " push_back", size, total, size);
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    bench::Session session{argc, argv};
+    for (std::size_t size : {1'000u, 100'000u, 1'000'000u}) {
+        bench_push_back<container::Vector<int>>("Vector<int>", size);
+        bench_push_back<std::vector<int>>("std::vector<int>", size);
+        bench_push_back<container::Vector<std::string>>("Vector<std::string>", size);
+        bench_push_back<std::vector<std::string>>("std::vector<std::string>", size);
+        bench_push_back<container::Vector<Pod256>>("Vector<Pod256>", size);
+        bench_push_back<std::vector<Pod256>>("std::vector<Pod256>", size);
+    }
+    return 0;
+}
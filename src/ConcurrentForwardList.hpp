@@ -0,0 +1,624 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace container {
+	// Singly linked list that any number of threads may modify and traverse at
+	// once without locks (Harris' list). An element is erased in two steps: the
+	// low bit of its next pointer is set, which stops every insertion or erasure
+	// after it, and then it is unlinked by whichever thread succeeds first.
+	//
+	// Unlinked nodes are reclaimed with epochs: every operation runs inside a
+	// Guard that announces the global epoch it started in, and the epoch only
+	// moves on once no Guard is left two epochs behind. A node unlinked in
+	// epoch e is freed once the epoch has reached e + 3, when no thread can
+	// still be reading it. Iterators must be used while a Guard from pin() is
+	// alive.
+	template <typename T, typename Allocator = std::allocator<T>>
+	class ConcurrentForwardList {
+			// Next pointer with the erased mark in its low bit
+			struct Link{
+				std::atomic<std::uintptr_t> next{0};
+			};
+
+			// Node of the list
+			struct Node : Link{
+				template<class... Args>
+				explicit Node(Args&&... args)
+					:value(std::forward<Args>(args)...) {}
+
+				T value;
+				Node *retired_next{}; // chain of unlinked nodes waiting to be freed
+				std::uint64_t retired_epoch{};
+			};
+
+			// Readers of one epoch parity, spread over cache lines by thread
+			struct alignas(64) Reader_count{
+				std::atomic<std::size_t> count{0};
+			};
+
+			static constexpr std::size_t reader_stripes = 16;
+			static constexpr std::size_t advance_period = 64; // unlinked nodes between attempts to free them
+
+			// allocator rebound to the node type
+			using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+			using node_traits = std::allocator_traits<node_allocator>;
+
+		public:
+			using value_type = T;
+			using allocator_type = Allocator;
+
+			// Constructors, destructor
+			ConcurrentForwardList();
+			explicit ConcurrentForwardList(const Allocator &alloc);
+			ConcurrentForwardList(std::initializer_list<T> init, const Allocator &alloc = Allocator());
+			ConcurrentForwardList(const ConcurrentForwardList &list) = delete; // shared between threads
+			ConcurrentForwardList &operator=(const ConcurrentForwardList &list) = delete;
+			virtual ~ConcurrentForwardList();
+			allocator_type get_allocator() const;
+
+			// Inner classes
+			class Guard;
+			class const_iterator;
+
+			// Epoch protection for iterators
+			Guard pin() const;
+
+			// Iterators, valid while a Guard is alive, they skip erased elements
+			const_iterator before_begin() const noexcept;
+			const_iterator cbefore_begin() const noexcept;
+			const_iterator begin() const noexcept;
+			const_iterator cbegin() const noexcept;
+			const_iterator end() const noexcept;
+			const_iterator cend() const noexcept;
+
+			// Capacity
+			bool empty() const;
+			std::size_t size() const; // exact only while no thread modifies the list
+
+			// Modifiers
+			template<class... Args>
+			void emplace_front(Args&&... args);
+			void push_front(const T &value);
+			void push_front(T &&value);
+			template<class... Args>
+			const_iterator emplace_after(const_iterator it, Args&&... args);
+			const_iterator insert_after(const_iterator it, const T &value);
+			const_iterator insert_after(const_iterator it, T &&value);
+			bool erase_after(const_iterator it);
+			bool pop_front();
+			bool pop_front(T &value);
+			void clear();
+
+			//Operations
+			bool contains(const T &value) const;
+			template<class UnaryPredicate>
+			bool contains_if(UnaryPredicate pred) const;
+			std::string toString(const std::string & name = "") const;
+
+		private:
+			Link m_head;
+			std::atomic<std::size_t> m_size;
+			mutable std::atomic<std::uint64_t> m_epoch;
+			mutable Reader_count m_readers[2][reader_stripes];
+			std::atomic<Node *> m_retired;
+			std::atomic<std::size_t> m_retired_count;
+			node_allocator m_alloc;
+
+			// helpers
+			static Node *pointer(std::uintptr_t link) noexcept;
+			static bool marked(std::uintptr_t link) noexcept;
+			static std::uintptr_t word(const Node *node, bool mark = false) noexcept;
+			static Node *skip_erased(Node *node) noexcept;
+			template<class... Args>
+			Node *create_node(Args&&... args);
+			void destroy_node(Node *node) noexcept;
+			const_iterator link_after(Link *pred, Node *node);
+			bool unlink_after(Link *pred, T *value);
+			void retire(Node *node);
+			bool try_advance();
+			void free_retired(bool all) noexcept;
+			std::uint64_t enter() const;
+			void leave(std::uint64_t epoch) const noexcept;
+			static std::size_t stripe() noexcept;
+	};
+
+	//-------------- Inner class Guard --------//
+	// Keeps the nodes a thread can reach from being freed while it is alive
+	template <typename T, typename Allocator>
+	class ConcurrentForwardList<T, Allocator>::Guard {
+	public:
+		Guard(Guard &&other) noexcept;
+		Guard(const Guard &other) = delete;
+		Guard &operator=(const Guard &other) = delete;
+		Guard &operator=(Guard &&other) = delete;
+		~Guard();
+
+	private:
+		const ConcurrentForwardList *m_list; // members
+		std::uint64_t m_epoch;
+
+		explicit Guard(const ConcurrentForwardList *list); // constructor
+		friend class ConcurrentForwardList<T, Allocator>;
+	};
+
+//-------------- Class ConcurrentForwardList Implementation --------------//
+	// Constructors, destructor //
+	template <typename T, typename Allocator>
+	ConcurrentForwardList<T, Allocator>::ConcurrentForwardList() :ConcurrentForwardList{Allocator()} {}
+
+	template <typename T, typename Allocator>
+	ConcurrentForwardList<T, Allocator>::ConcurrentForwardList(const Allocator &alloc)
+		:m_head{}, m_size{0}, m_epoch{0}, m_retired{nullptr}, m_retired_count{0}, m_alloc{alloc} {}
+
+	template <typename T, typename Allocator>
+	ConcurrentForwardList<T, Allocator>::ConcurrentForwardList(std::initializer_list<T> init, const Allocator &alloc)
+		:ConcurrentForwardList{alloc} {
+		auto it = cbefore_begin();
+		for (const auto &element : init) {
+			it = insert_after(it, element);
+		}
+	}
+
+	// no other thread may use the list any more, every node can be freed
+	template <typename T, typename Allocator>
+	ConcurrentForwardList<T, Allocator>::~ConcurrentForwardList() {
+		Node *node = pointer(m_head.next.load(std::memory_order_acquire));
+		while (node) {
+			Node *next = pointer(node->next.load(std::memory_order_relaxed));
+			destroy_node(node);
+			node = next;
+		}
+		free_retired(true);
+	}
+
+	template <typename T, typename Allocator>
+	typename ConcurrentForwardList<T, Allocator>::allocator_type ConcurrentForwardList<T, Allocator>::get_allocator() const {
+		return allocator_type(m_alloc);
+	}
+
+	template <typename T, typename Allocator>
+	typename ConcurrentForwardList<T, Allocator>::Guard ConcurrentForwardList<T, Allocator>::pin() const {
+		return Guard{this};
+	}
+
+	//-----------------  Iterators -----------------//
+	template <typename T, typename Allocator>
+	typename ConcurrentForwardList<T, Allocator>::const_iterator ConcurrentForwardList<T, Allocator>::before_begin() const noexcept {
+		return cbefore_begin();
+	}
+
+	template <typename T, typename Allocator>
+	typename ConcurrentForwardList<T, Allocator>::const_iterator ConcurrentForwardList<T, Allocator>::cbefore_begin() const noexcept {
+		return const_iterator{const_cast<Link *>(&m_head)};
+	}
+
+	template <typename T, typename Allocator>
+	typename ConcurrentForwardList<T, Allocator>::const_iterator ConcurrentForwardList<T, Allocator>::begin() const noexcept {
+		return cbegin();
+	}
+
+	template <typename T, typename Allocator>
+	typename ConcurrentForwardList<T, Allocator>::const_iterator ConcurrentForwardList<T, Allocator>::cbegin() const noexcept {
+		return const_iterator{skip_erased(pointer(m_head.next.load(std::memory_order_acquire)))};
+	}
+
+	template <typename T, typename Allocator>
+	typename ConcurrentForwardList<T, Allocator>::const_iterator ConcurrentForwardList<T, Allocator>::end() const noexcept {
+		return cend();
+	}
+
+	template <typename T, typename Allocator>
+	typename ConcurrentForwardList<T, Allocator>::const_iterator ConcurrentForwardList<T, Allocator>::cend() const noexcept {
+		return const_iterator{};
+	}
+
+	//-----------------  Capacity ------------------//
+	template <typename T, typename Allocator>
+	bool ConcurrentForwardList<T, Allocator>::empty() const {
+		Guard guard{this};
+		return cbegin() == cend();
+	}
+
+	template <typename T, typename Allocator>
+	std::size_t ConcurrentForwardList<T, Allocator>::size() const {
+		return m_size.load(std::memory_order_relaxed);
+	}
+
+	//-----------------  Modifiers -----------------//
+	template <typename T, typename Allocator>
+	template <class... Args>
+	void ConcurrentForwardList<T, Allocator>::emplace_front(Args&&... args) {
+		Guard guard{this};
+		link_after(&m_head, create_node(std::forward<Args>(args)...));
+	}
+
+	template <typename T, typename Allocator>
+	void ConcurrentForwardList<T, Allocator>::push_front(const T &value) {
+		emplace_front(value);
+	}
+
+	template <typename T, typename Allocator>
+	void ConcurrentForwardList<T, Allocator>::push_front(T &&value) {
+		emplace_front(std::move(value));
+	}
+
+	// fails and returns end() when the element at it has been erased
+	template <typename T, typename Allocator>
+	template <class... Args>
+	typename ConcurrentForwardList<T, Allocator>::const_iterator ConcurrentForwardList<T, Allocator>::emplace_after(const_iterator it, Args&&... args) {
+		if (!it.current_node) {
+			throw std::runtime_error("ERROR: Empty or null Iterator");
+		}
+		Guard guard{this};
+		return link_after(it.current_node, create_node(std::forward<Args>(args)...));
+	}
+
+	template <typename T, typename Allocator>
+	typename ConcurrentForwardList<T, Allocator>::const_iterator ConcurrentForwardList<T, Allocator>::insert_after(const_iterator it, const T &value) {
+		return emplace_after(it, value);
+	}
+
+	template <typename T, typename Allocator>
+	typename ConcurrentForwardList<T, Allocator>::const_iterator ConcurrentForwardList<T, Allocator>::insert_after(const_iterator it, T &&value) {
+		return emplace_after(it, std::move(value));
+	}
+
+	// erases the first element after it that is not erased yet, returns false
+	// when there is none or when the element at it has been erased
+	template <typename T, typename Allocator>
+	bool ConcurrentForwardList<T, Allocator>::erase_after(const_iterator it) {
+		if (!it.current_node) {
+			throw std::runtime_error("ERROR: Empty or null Iterator");
+		}
+		Guard guard{this};
+		return unlink_after(it.current_node, nullptr);
+	}
+
+	template <typename T, typename Allocator>
+	bool ConcurrentForwardList<T, Allocator>::pop_front() {
+		Guard guard{this};
+		return unlink_after(&m_head, nullptr);
+	}
+
+	template <typename T, typename Allocator>
+	bool ConcurrentForwardList<T, Allocator>::pop_front(T &value) {
+		Guard guard{this};
+		return unlink_after(&m_head, &value);
+	}
+
+	template <typename T, typename Allocator>
+	void ConcurrentForwardList<T, Allocator>::clear() {
+		while (pop_front()) {}
+	}
+
+	//-----------------  Operations -----------------//
+	template <typename T, typename Allocator>
+	bool ConcurrentForwardList<T, Allocator>::contains(const T &value) const {
+		return contains_if([&value](const T &element) { return element == value; });
+	}
+
+	template <typename T, typename Allocator>
+	template <class UnaryPredicate>
+	bool ConcurrentForwardList<T, Allocator>::contains_if(UnaryPredicate pred) const {
+		Guard guard{this};
+		for (const auto &element : *this) {
+			if (pred(element)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	template <typename T, typename Allocator>
+	std::string ConcurrentForwardList<T, Allocator>::toString(const std::string & name) const {
+		Guard guard{this};
+		std::stringstream stream;
+		stream << "\n<===== ConcurrentForwardList: " << name << " ======>\n >>Size:" << size();
+		std::size_t index = 0;
+		for (const auto &it : *this) {
+			stream << "\n [" << index << "]=> " << it ;
+			index++;
+		}
+		stream << "\n<=== End " << name << " ====>\n";
+		return stream.str();
+	}
+
+	// private member function
+	template <typename T, typename Allocator>
+	typename ConcurrentForwardList<T, Allocator>::Node *ConcurrentForwardList<T, Allocator>::pointer(std::uintptr_t link) noexcept {
+		return reinterpret_cast<Node *>(link & ~std::uintptr_t{1});
+	}
+
+	// private member function
+	template <typename T, typename Allocator>
+	bool ConcurrentForwardList<T, Allocator>::marked(std::uintptr_t link) noexcept {
+		return link & 1;
+	}
+
+	// private member function
+	template <typename T, typename Allocator>
+	std::uintptr_t ConcurrentForwardList<T, Allocator>::word(const Node *node, bool mark) noexcept {
+		return reinterpret_cast<std::uintptr_t>(node) | static_cast<std::uintptr_t>(mark);
+	}
+
+	// private member function, first node from node on that is not erased
+	template <typename T, typename Allocator>
+	typename ConcurrentForwardList<T, Allocator>::Node *ConcurrentForwardList<T, Allocator>::skip_erased(Node *node) noexcept {
+		while (node) {
+			std::uintptr_t next = node->next.load(std::memory_order_acquire);
+			if (!marked(next)) {
+				break;
+			}
+			node = pointer(next);
+		}
+		return node;
+	}
+
+	// private member function
+	template <typename T, typename Allocator>
+	template <class... Args>
+	typename ConcurrentForwardList<T, Allocator>::Node *ConcurrentForwardList<T, Allocator>::create_node(Args&&... args) {
+		Node *node = node_traits::allocate(m_alloc, 1);
+		try {
+			node_traits::construct(m_alloc, node, std::forward<Args>(args)...);
+		} catch (...) {
+			node_traits::deallocate(m_alloc, node, 1);
+			throw;
+		}
+		return node;
+	}
+
+	// private member function
+	template <typename T, typename Allocator>
+	void ConcurrentForwardList<T, Allocator>::destroy_node(Node *node) noexcept {
+		node_traits::destroy(m_alloc, node);
+		node_traits::deallocate(m_alloc, node, 1);
+	}
+
+	// private member function, publishes node right after pred. Erased nodes
+	// found after pred are unlinked first, an erased pred makes it fail.
+	template <typename T, typename Allocator>
+	typename ConcurrentForwardList<T, Allocator>::const_iterator ConcurrentForwardList<T, Allocator>::link_after(Link *pred, Node *node) {
+		std::uintptr_t next = pred->next.load(std::memory_order_acquire);
+		for (;;) {
+			if (marked(next)) {
+				destroy_node(node);
+				return cend();
+			}
+			Node *successor = pointer(next);
+			if (successor) {
+				std::uintptr_t after = successor->next.load(std::memory_order_acquire);
+				if (marked(after)) {
+					if (pred->next.compare_exchange_strong(next, word(pointer(after)), std::memory_order_acq_rel, std::memory_order_acquire)) {
+						retire(successor);
+						next = word(pointer(after));
+					}
+					continue;
+				}
+			}
+			node->next.store(next, std::memory_order_relaxed);
+			if (pred->next.compare_exchange_weak(next, word(node), std::memory_order_release, std::memory_order_acquire)) {
+				m_size.fetch_add(1, std::memory_order_relaxed);
+				return const_iterator{node};
+			}
+		}
+	}
+
+	// private member function, marks the first live node after pred as erased,
+	// then tries once to unlink it. A failed unlink is finished by the next
+	// thread that passes the node.
+	template <typename T, typename Allocator>
+	bool ConcurrentForwardList<T, Allocator>::unlink_after(Link *pred, T *value) {
+		std::uintptr_t next = pred->next.load(std::memory_order_acquire);
+		for (;;) {
+			if (marked(next)) {
+				return false;
+			}
+			Node *victim = pointer(next);
+			if (!victim) {
+				return false;
+			}
+			std::uintptr_t after = victim->next.load(std::memory_order_acquire);
+			if (marked(after)) {
+				// already erased by another thread, help unlinking it
+				if (pred->next.compare_exchange_strong(next, word(pointer(after)), std::memory_order_acq_rel, std::memory_order_acquire)) {
+					retire(victim);
+					next = word(pointer(after));
+				}
+				continue;
+			}
+			if (!victim->next.compare_exchange_strong(after, word(pointer(after), true), std::memory_order_acq_rel, std::memory_order_acquire)) {
+				continue;
+			}
+			m_size.fetch_sub(1, std::memory_order_relaxed);
+			if (value) {
+				*value = victim->value;
+			}
+			if (pred->next.compare_exchange_strong(next, word(pointer(after)), std::memory_order_acq_rel, std::memory_order_acquire)) {
+				retire(victim);
+			}
+			return true;
+		}
+	}
+
+	// private member function, a thread that reached the node before it was
+	// unlinked entered at most one epoch after the unlinking Guard, so three
+	// epochs later it has left
+	template <typename T, typename Allocator>
+	void ConcurrentForwardList<T, Allocator>::retire(Node *node) {
+		node->retired_epoch = m_epoch.load(std::memory_order_seq_cst);
+		node->retired_next = m_retired.load(std::memory_order_relaxed);
+		while (!m_retired.compare_exchange_weak(node->retired_next, node, std::memory_order_release, std::memory_order_relaxed)) {}
+
+		if ((m_retired_count.fetch_add(1, std::memory_order_relaxed) + 1) % advance_period == 0) {
+			if (try_advance()) {
+				free_retired(false);
+			}
+		}
+	}
+
+	// private member function, the epoch moves from e to e + 1 once no guard of
+	// e - 1 is left, so guards are always in the last two epochs. Returns false
+	// while a guard holds it back: nothing new can be freed then.
+	template <typename T, typename Allocator>
+	bool ConcurrentForwardList<T, Allocator>::try_advance() {
+		std::uint64_t epoch = m_epoch.load(std::memory_order_seq_cst);
+		for (const auto &reader : m_readers[(epoch + 1) & 1]) {
+			if (reader.count.load(std::memory_order_seq_cst) != 0) {
+				return false;
+			}
+		}
+		m_epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+		return true;
+	}
+
+	// private member function, frees the retired nodes that are three epochs
+	// old (all of them from the destructor) and puts the others back
+	template <typename T, typename Allocator>
+	void ConcurrentForwardList<T, Allocator>::free_retired(bool all) noexcept {
+		Node *node = m_retired.exchange(nullptr, std::memory_order_acquire);
+		const std::uint64_t epoch = m_epoch.load(std::memory_order_seq_cst);
+		Node *kept = nullptr;
+		Node *kept_last = nullptr;
+		while (node) {
+			Node *next = node->retired_next;
+			if (all || node->retired_epoch + 3 <= epoch) {
+				destroy_node(node);
+			} else {
+				node->retired_next = kept;
+				kept = node;
+				if (!kept_last) {
+					kept_last = node;
+				}
+			}
+			node = next;
+		}
+		if (kept) {
+			kept_last->retired_next = m_retired.load(std::memory_order_relaxed);
+			while (!m_retired.compare_exchange_weak(kept_last->retired_next, kept, std::memory_order_release, std::memory_order_relaxed)) {}
+		}
+	}
+
+	// private member function, announces the current epoch. The epoch is read
+	// again after the announcement: an advance that missed it is detected and
+	// the announcement is made again.
+	template <typename T, typename Allocator>
+	std::uint64_t ConcurrentForwardList<T, Allocator>::enter() const {
+		auto &readers = m_readers;
+		const std::size_t index = stripe();
+		for (;;) {
+			std::uint64_t epoch = m_epoch.load(std::memory_order_seq_cst);
+			readers[epoch & 1][index].count.fetch_add(1, std::memory_order_seq_cst);
+			if (m_epoch.load(std::memory_order_seq_cst) == epoch) {
+				return epoch;
+			}
+			readers[epoch & 1][index].count.fetch_sub(1, std::memory_order_release);
+		}
+	}
+
+	// private member function
+	template <typename T, typename Allocator>
+	void ConcurrentForwardList<T, Allocator>::leave(std::uint64_t epoch) const noexcept {
+		m_readers[epoch & 1][stripe()].count.fetch_sub(1, std::memory_order_release);
+	}
+
+	// private member function, reader counter used by the calling thread
+	template <typename T, typename Allocator>
+	std::size_t ConcurrentForwardList<T, Allocator>::stripe() noexcept {
+		thread_local const std::size_t index = std::hash<std::thread::id>{}(std::this_thread::get_id()) % reader_stripes;
+		return index;
+	}
+
+	//---------------- Non-member functions ----------------//
+	template<typename T, typename Allocator>
+	std::ostream& operator<<(std::ostream& os, const ConcurrentForwardList<T, Allocator> & list) {
+		auto guard = list.pin();
+		for (const auto &it : list) {
+			os << it << "->";
+		}
+		os << "NULL";
+
+		return os;
+	}
+
+	//-------------- class Guard implementation--------//
+	template <typename T, typename Allocator>
+	ConcurrentForwardList<T, Allocator>::Guard::Guard(const ConcurrentForwardList *list)
+		:m_list{list}, m_epoch{list->enter()} {}
+
+	template <typename T, typename Allocator>
+	ConcurrentForwardList<T, Allocator>::Guard::Guard(Guard &&other) noexcept
+		:m_list{other.m_list}, m_epoch{other.m_epoch} {
+		other.m_list = nullptr;
+	}
+
+	template <typename T, typename Allocator>
+	ConcurrentForwardList<T, Allocator>::Guard::~Guard() {
+		if (m_list) {
+			m_list->leave(m_epoch);
+		}
+	}
+
+	//-------------- Inner class const_iterator --------//
+	template <typename T, typename Allocator>
+	class ConcurrentForwardList<T, Allocator>::const_iterator {
+	public:
+		const_iterator();
+
+		const T & operator*() const;
+		const_iterator & operator++(); // Prefix
+		const_iterator operator++(int);// Postfix
+		bool operator==(const const_iterator & other) const;
+		bool operator!=(const const_iterator & other) const;
+
+	protected:
+		Link *current_node{}; // member
+
+		explicit const_iterator(Link *new_ptr); // constructor
+		friend class ConcurrentForwardList<T, Allocator>;
+	};
+
+	//-------------- class const_iterator implementation--------//
+	template <typename T, typename Allocator>
+	ConcurrentForwardList<T, Allocator>::const_iterator::const_iterator() :current_node{nullptr} {}
+
+	//protected constructor
+	template <typename T, typename Allocator>
+	ConcurrentForwardList<T, Allocator>::const_iterator::const_iterator(Link *new_ptr) :current_node{new_ptr} {}
+
+	template <typename T, typename Allocator>
+	const T &ConcurrentForwardList<T, Allocator>::const_iterator::operator*() const {
+		return static_cast<Node *>(current_node)->value;
+	}
+
+	template <typename T, typename Allocator>
+	typename ConcurrentForwardList<T, Allocator>::const_iterator &ConcurrentForwardList<T, Allocator>::const_iterator::operator++() { // Prefix
+		current_node = skip_erased(pointer(current_node->next.load(std::memory_order_acquire)));
+		return *this;
+	}
+
+	template <typename T, typename Allocator>
+	typename ConcurrentForwardList<T, Allocator>::const_iterator ConcurrentForwardList<T, Allocator>::const_iterator::operator++(int) { // Postfix
+		const_iterator temp = *this;
+		++(*this);
+		return temp;
+	}
+
+	template <typename T, typename Allocator>
+	bool ConcurrentForwardList<T, Allocator>::const_iterator::operator==(const const_iterator &other) const {
+		return current_node == other.current_node;
+	}
+
+	template <typename T, typename Allocator>
+	bool ConcurrentForwardList<T, Allocator>::const_iterator::operator!=(const const_iterator &other) const {
+		return !(*this == other);
+	}
+} // namespace  container
@@ -0,0 +1,772 @@
+#pragma once
+
+#include <stdexcept>
+#include <initializer_list>
+#include <sstream>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include "Vector.hpp"
+
+namespace container {
+
+    // Double ended queue keeping its elements in fixed-size blocks. A Vector of
+    // block pointers (the map) orders the blocks and keeps free slots at both
+    // ends, so pushing at either end never moves an element: references stay
+    // valid until their element is removed.
+    template<typename T, typename Allocator = std::allocator<T>>
+    class Deque {
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using map_type = Vector<T *, typename alloc_traits::template rebind_alloc<T *>>;
+
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        static constexpr std::size_t block_size = sizeof(T) < 256 ? 4096 / sizeof(T) : 16;
+
+        // Constructors and destructor
+        Deque();
+        explicit Deque(const Allocator &alloc);
+        explicit Deque(std::size_t count, const Allocator &alloc = Allocator());
+        Deque(const Deque &other); // copy constructor
+        Deque(Deque &&other) noexcept; // move constructor
+        Deque(std::initializer_list<T> elements, const Allocator &alloc = Allocator());
+        virtual ~Deque();
+        Deque<T, Allocator> &operator=(const Deque &other); // applies copy and swap idiom
+        Deque<T, Allocator> &operator=(Deque &&other) noexcept;
+        allocator_type get_allocator() const;
+
+        // Element access
+        T &at(std::size_t index);
+        const T &at(std::size_t index) const;
+        T &operator[](const std::size_t index);
+        const T &operator[](const std::size_t index) const;
+        T &front();
+        const T &front() const;
+        T &back();
+        const T &back() const;
+
+        // Inner classes
+        class const_iterator;
+        class iterator;
+
+        // Iterators
+        iterator begin() noexcept;
+        const_iterator begin() const noexcept;
+        const_iterator cbegin() const noexcept;
+        iterator end() noexcept;
+        const_iterator end() const noexcept;
+        const_iterator cend() const noexcept;
+
+        // Capacity
+        bool empty() const noexcept;
+        std::size_t size() const;
+
+        // Modifiers
+        template<class... Args>
+        T &emplace_front(Args&&... args);
+        template<class... Args>
+        T &emplace_back(Args&&... args);
+        void push_front(const T &value);
+        void push_front(T &&value);
+        void push_back(const T &value);
+        void push_back(T &&value);
+        void pop_front();
+        void pop_back();
+        void clear() noexcept;
+        void swap(Deque &deque) noexcept;
+
+        //Operations
+        std::string toString(const std::string &name = "") const;
+        bool operator==(const Deque& other) const;
+        bool operator!=(const Deque& other) const;
+
+    private:
+        T *slot_address(std::size_t position) const;
+        T **slot_of(std::size_t position) const;
+        void reserve_slot(std::size_t slot);
+        void grow_map();
+        T *allocate_block();
+        void deallocate_block(T *block) noexcept;
+        void release_storage() noexcept;
+
+    private: // members
+        std::size_t m_size;
+        std::size_t m_offset; // position of the first element counted from the first slot of the map
+        map_type m_map; // block pointers, nullptr for unused slots
+        Allocator m_alloc;
+    };
+
+//-------------- Class Deque Implementation ------------//
+    //------ Constructors, destructor ----------//
+    template<typename T, typename Allocator>
+    Deque<T, Allocator>::Deque() :Deque{Allocator()} {}
+
+    template<typename T, typename Allocator>
+    Deque<T, Allocator>::Deque(const Allocator &alloc)
+        :m_size{}, m_offset{}, m_map{typename map_type::allocator_type(alloc)}, m_alloc{alloc} {}
+
+    template<typename T, typename Allocator>
+    Deque<T, Allocator>::Deque(std::size_t count, const Allocator &alloc) :Deque{alloc} {
+        for (std::size_t i = 0; i < count; ++i){
+            emplace_back();
+        }
+    }
+
+    template<typename T, typename Allocator>
+    Deque<T, Allocator>::Deque(const Deque &other)
+        :Deque{alloc_traits::select_on_container_copy_construction(other.m_alloc)} {
+        for (const auto &element : other){
+            push_back(element);
+        }
+    }
+
+    template<typename T, typename Allocator>
+    Deque<T, Allocator>::Deque(Deque &&other) noexcept :Deque{other.m_alloc} {
+        swap(other);
+    }
+
+    template<typename T, typename Allocator>
+    Deque<T, Allocator>::Deque(std::initializer_list<T> elements, const Allocator &alloc) :Deque{alloc} {
+        for (auto &element : elements){
+            push_back(element);
+        }
+    }
+
+    template<typename T, typename Allocator>
+    Deque<T, Allocator>::~Deque(){
+        release_storage();
+    }
+
+    // applying copy-and-swap idiom
+    template<typename T, typename Allocator>
+    Deque<T, Allocator> &Deque<T, Allocator>::operator=(const Deque &other) {
+        if (this != &other){
+            Deque temp{other};
+            swap(temp);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Allocator>
+    Deque<T, Allocator> &Deque<T, Allocator>::operator=(Deque &&other) noexcept {
+        if (this != &other){
+            release_storage();
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value){
+                m_alloc = other.m_alloc;
+            }
+            swap(other);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::allocator_type Deque<T, Allocator>::get_allocator() const {
+        return m_alloc;
+    }
+
+    //--------------- Element access ---------------//
+    template<typename T, typename Allocator>
+    T &Deque<T, Allocator>::at(std::size_t index){
+        if (index >= m_size){
+            throw std::out_of_range("ERROR: Index out of bounds in Deque");
+        }
+        return *slot_address(m_offset + index);
+    }
+
+    template<typename T, typename Allocator>
+    const T &Deque<T, Allocator>::at(std::size_t index) const {
+        if (index >= m_size){
+            throw std::out_of_range("ERROR: Index out of bounds in Deque");
+        }
+        return *slot_address(m_offset + index);
+    }
+
+    template<typename T, typename Allocator>
+    T &Deque<T, Allocator>::operator[](const std::size_t index){
+        return *slot_address(m_offset + index);
+    }
+
+    template<typename T, typename Allocator>
+    const T &Deque<T, Allocator>::operator[](const std::size_t index) const {
+        return *slot_address(m_offset + index);
+    }
+
+    template<typename T, typename Allocator>
+    T &Deque<T, Allocator>::front(){
+        if (empty()){
+            throw std::runtime_error("ERROR: Empty container");
+        }
+        return *slot_address(m_offset);
+    }
+
+    template<typename T, typename Allocator>
+    const T &Deque<T, Allocator>::front() const {
+        if (empty()){
+            throw std::runtime_error("ERROR: Empty container");
+        }
+        return *slot_address(m_offset);
+    }
+
+    template<typename T, typename Allocator>
+    T &Deque<T, Allocator>::back(){
+        if (empty()){
+            throw std::runtime_error("ERROR: Empty container");
+        }
+        return *slot_address(m_offset + m_size - 1);
+    }
+
+    template<typename T, typename Allocator>
+    const T &Deque<T, Allocator>::back() const {
+        if (empty()){
+            throw std::runtime_error("ERROR: Empty container");
+        }
+        return *slot_address(m_offset + m_size - 1);
+    }
+
+    //---------------- Iterators ------------------//
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::iterator Deque<T, Allocator>::begin() noexcept {
+        if (m_map.empty()){
+            return iterator{};
+        }
+        return iterator{slot_of(m_offset), m_offset % block_size};
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::const_iterator Deque<T, Allocator>::begin() const noexcept {
+        return cbegin();
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::const_iterator Deque<T, Allocator>::cbegin() const noexcept {
+        if (m_map.empty()){
+            return const_iterator{};
+        }
+        return const_iterator{slot_of(m_offset), m_offset % block_size};
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::iterator Deque<T, Allocator>::end() noexcept {
+        if (m_map.empty()){
+            return iterator{};
+        }
+        return iterator{slot_of(m_offset + m_size), (m_offset + m_size) % block_size};
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::const_iterator Deque<T, Allocator>::end() const noexcept {
+        return cend();
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::const_iterator Deque<T, Allocator>::cend() const noexcept {
+        if (m_map.empty()){
+            return const_iterator{};
+        }
+        return const_iterator{slot_of(m_offset + m_size), (m_offset + m_size) % block_size};
+    }
+
+    //----------------- Capacity ------------------//
+    template<typename T, typename Allocator>
+    bool Deque<T, Allocator>::empty() const noexcept {
+        return m_size == 0;
+    }
+
+    template<typename T, typename Allocator>
+    std::size_t Deque<T, Allocator>::size() const {
+        return m_size;
+    }
+
+    //----------------- Modifiers -----------------//
+    template<typename T, typename Allocator>
+    template<class... Args>
+    T &Deque<T, Allocator>::emplace_front(Args&&... args){
+        if (m_offset == 0){
+            grow_map();
+        }
+        reserve_slot((m_offset - 1) / block_size);
+        T *place = slot_address(m_offset - 1);
+        alloc_traits::construct(m_alloc, place, std::forward<Args>(args)...);
+        --m_offset;
+        ++m_size;
+        return *place;
+    }
+
+    // the slot after the last element always exists, end() points into it
+    template<typename T, typename Allocator>
+    template<class... Args>
+    T &Deque<T, Allocator>::emplace_back(Args&&... args){
+        const std::size_t position = m_offset + m_size;
+        if ((position + 1) / block_size >= m_map.size()){
+            grow_map();
+        }
+        const std::size_t last = m_offset + m_size;
+        reserve_slot(last / block_size);
+        T *place = slot_address(last);
+        alloc_traits::construct(m_alloc, place, std::forward<Args>(args)...);
+        ++m_size;
+        return *place;
+    }
+
+    template<typename T, typename Allocator>
+    void Deque<T, Allocator>::push_front(const T &value){
+        emplace_front(value);
+    }
+
+    template<typename T, typename Allocator>
+    void Deque<T, Allocator>::push_front(T &&value){
+        emplace_front(std::move(value));
+    }
+
+    template<typename T, typename Allocator>
+    void Deque<T, Allocator>::push_back(const T &value){
+        emplace_back(value);
+    }
+
+    template<typename T, typename Allocator>
+    void Deque<T, Allocator>::push_back(T &&value){
+        emplace_back(std::move(value));
+    }
+
+    // a block is given back once its last element is removed
+    template<typename T, typename Allocator>
+    void Deque<T, Allocator>::pop_front(){
+        if (empty()){
+            throw std::runtime_error("ERROR: Empty container");
+        }
+        alloc_traits::destroy(m_alloc, slot_address(m_offset));
+        ++m_offset;
+        --m_size;
+        if (m_offset % block_size == 0){
+            T **slot = slot_of(m_offset - 1);
+            deallocate_block(*slot);
+            *slot = nullptr;
+        }
+    }
+
+    template<typename T, typename Allocator>
+    void Deque<T, Allocator>::pop_back(){
+        if (empty()){
+            throw std::runtime_error("ERROR: Empty container");
+        }
+        --m_size;
+        const std::size_t last = m_offset + m_size;
+        alloc_traits::destroy(m_alloc, slot_address(last));
+        if (last % block_size == 0){
+            T **slot = slot_of(last);
+            deallocate_block(*slot);
+            *slot = nullptr;
+        }
+    }
+
+    // the map keeps its slots, so refilling a cleared deque does not regrow it
+    template<typename T, typename Allocator>
+    void Deque<T, Allocator>::clear() noexcept {
+        for (std::size_t i = 0; i < m_size; ++i){
+            alloc_traits::destroy(m_alloc, slot_address(m_offset + i));
+        }
+        for (auto &block : m_map){
+            deallocate_block(block);
+            block = nullptr;
+        }
+        m_size = 0;
+        m_offset = m_map.size() / 2 * block_size;
+    }
+
+    template<typename T, typename Allocator>
+    void Deque<T, Allocator>::swap(Deque &deque) noexcept {
+        std::swap(m_size, deque.m_size);
+        std::swap(m_offset, deque.m_offset);
+        m_map.swap(deque.m_map);
+        if constexpr (alloc_traits::propagate_on_container_swap::value){
+            std::swap(m_alloc, deque.m_alloc);
+        }
+    }
+
+    // private member function
+    template<typename T, typename Allocator>
+    T *Deque<T, Allocator>::slot_address(std::size_t position) const {
+        return m_map[position / block_size] + position % block_size;
+    }
+
+    // private member function
+    template<typename T, typename Allocator>
+    T **Deque<T, Allocator>::slot_of(std::size_t position) const {
+        return const_cast<T **>(m_map.data()) + position / block_size;
+    }
+
+    // private member function, gives an unused slot its block
+    template<typename T, typename Allocator>
+    void Deque<T, Allocator>::reserve_slot(std::size_t slot) {
+        if (!m_map[slot]){
+            m_map[slot] = allocate_block();
+        }
+    }
+
+    // private member function, doubles the map when the used slots fill more
+    // than half of it and centres them, blocks are moved by pointer only
+    template<typename T, typename Allocator>
+    void Deque<T, Allocator>::grow_map() {
+        const std::size_t first = m_offset / block_size;
+        const std::size_t used = m_map.empty() ? 0 : (m_offset + m_size) / block_size - first + 1;
+        const std::size_t needed = used + 2; // a new block and the slot after the last element
+        const std::size_t slots = m_map.size() >= 2 * needed ? m_map.size() : std::max<std::size_t>(8, 2 * needed);
+
+        map_type map(slots, m_map.get_allocator());
+        const std::size_t new_first = (slots - used) / 2;
+        for (std::size_t i = 0; i < m_map.size(); ++i){
+            if (i >= first && i < first + used){
+                map[new_first + i - first] = m_map[i];
+            } else {
+                deallocate_block(m_map[i]);
+            }
+        }
+        m_offset = new_first * block_size + m_offset % block_size;
+        m_map.swap(map);
+    }
+
+    // private member function
+    template<typename T, typename Allocator>
+    T *Deque<T, Allocator>::allocate_block() {
+        return alloc_traits::allocate(m_alloc, block_size);
+    }
+
+    // private member function
+    template<typename T, typename Allocator>
+    void Deque<T, Allocator>::deallocate_block(T *block) noexcept {
+        if (block){
+            alloc_traits::deallocate(m_alloc, block, block_size);
+        }
+    }
+
+    // private member function
+    template<typename T, typename Allocator>
+    void Deque<T, Allocator>::release_storage() noexcept {
+        clear();
+        m_map.clear();
+        m_offset = 0;
+    }
+
+    //------------------- Operations -----------------------//
+    template<typename T, typename Allocator>
+    std::string Deque<T, Allocator>::toString(const std::string &name) const {
+        std::stringstream stream;
+        stream << "\n<===== Deque: " << name << " ======>\n >>Size:" << m_size;
+        std::size_t index = 0;
+        for (const auto &it : *this) {
+            stream << "\n [" << index << "]=> " << it ;
+            index++;
+        }
+        stream << "\n<=== End " << name << " ====>\n";
+        return stream.str();
+    }
+
+    template<typename T, typename Allocator>
+    bool Deque<T, Allocator>::operator==(const Deque& other) const{
+        if (m_size != other.size()){
+            return false;
+        }
+        return std::equal(cbegin(), cend(), other.cbegin());
+    }
+
+    template<typename T, typename Allocator>
+    bool Deque<T, Allocator>::operator!=(const Deque& other) const{
+        return !(operator==(other));
+    }
+
+    //---------------- Non-member functions ----------------//
+    template<typename T, typename Allocator>
+    std::ostream& operator<<(std::ostream& os, const Deque<T, Allocator> & deque) {
+        for (const auto &it : deque) {
+            os << it << ", ";
+        }
+        os << "END";
+        return os;
+    }
+
+    //-------------- Inner class const_iterator --------//
+    // Random-access iterator walking the blocks through the map: the slot it
+    // is in, the start of that block and the element inside it
+    template<typename T, typename Allocator>
+    class Deque<T, Allocator>::const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator();
+
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        const_iterator& operator--();
+        const_iterator operator--(int);
+        const_iterator& operator+=(difference_type offset);
+        const_iterator& operator-=(difference_type offset);
+        const_iterator operator+(difference_type offset) const;
+        const_iterator operator-(difference_type offset) const;
+        friend const_iterator operator+(difference_type offset, const const_iterator &it) { return it + offset; }
+
+        const T& operator*() const;
+        const T* operator->() const;
+        const T& operator[](difference_type offset) const;
+
+        bool operator==(const const_iterator& other) const;
+        bool operator!=(const const_iterator& other) const;
+        bool operator<(const const_iterator& other) const;
+        bool operator>(const const_iterator& other) const;
+        bool operator<=(const const_iterator& other) const;
+        bool operator>=(const const_iterator& other) const;
+        difference_type operator-(const const_iterator& other) const;
+
+    protected:
+        T **m_slot; // members
+        T *m_block;
+        T *m_current;
+
+        const_iterator(T **slot, std::size_t index); // constructor
+        T &get() const; // get the value at the iterator current position
+        friend class Deque<T, Allocator>;
+    };
+
+    //------------------- Inner class iterator ------------------//
+    template<typename T, typename Allocator>
+    class Deque<T, Allocator>::iterator final: public const_iterator {
+    public:
+        using typename const_iterator::difference_type;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator();
+
+        T &operator*() const;
+        T *operator->() const;
+        T &operator[](difference_type offset) const;
+
+        iterator &operator++();
+        iterator operator++(int);
+        iterator &operator--();
+        iterator operator--(int);
+        iterator &operator+=(difference_type offset);
+        iterator &operator-=(difference_type offset);
+        iterator operator+(difference_type offset) const;
+        iterator operator-(difference_type offset) const;
+        using const_iterator::operator-; // distance between iterators
+        friend iterator operator+(difference_type offset, const iterator &it) { return it + offset; }
+
+    private:
+        iterator(T **slot, std::size_t index); // constructor
+        friend class Deque<T, Allocator>;
+    };
+
+    //-------------- class const_iterator implementation--------//
+    template<typename T, typename Allocator>
+    Deque<T, Allocator>::const_iterator::const_iterator() :m_slot{nullptr}, m_block{nullptr}, m_current{nullptr} {}
+
+    //protected constructor
+    template<typename T, typename Allocator>
+    Deque<T, Allocator>::const_iterator::const_iterator(T **slot, std::size_t index)
+        :m_slot{slot}, m_block{*slot}, m_current{m_block ? m_block + index : nullptr} {}
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::const_iterator &Deque<T, Allocator>::const_iterator::operator++(){
+        if (++m_current == m_block + block_size){
+            m_block = *++m_slot;
+            m_current = m_block;
+        }
+        return *this;
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::const_iterator Deque<T, Allocator>::const_iterator::operator++(int){
+        const_iterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::const_iterator &Deque<T, Allocator>::const_iterator::operator--(){
+        if (m_current == m_block){
+            m_block = *--m_slot;
+            m_current = m_block + block_size;
+        }
+        --m_current;
+        return *this;
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::const_iterator Deque<T, Allocator>::const_iterator::operator--(int){
+        const_iterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::const_iterator &Deque<T, Allocator>::const_iterator::operator+=(difference_type offset){
+        const auto size = static_cast<difference_type>(block_size);
+        const difference_type index = (m_current - m_block) + offset;
+        if (index >= 0 && index < size){
+            m_current += offset;
+            return *this;
+        }
+        const difference_type slots = index >= 0 ? index / size : -((-index - 1) / size) - 1;
+        m_slot += slots;
+        m_block = *m_slot;
+        m_current = m_block ? m_block + (index - slots * size) : nullptr;
+        return *this;
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::const_iterator &Deque<T, Allocator>::const_iterator::operator-=(difference_type offset){
+        return *this += -offset;
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::const_iterator Deque<T, Allocator>::const_iterator::operator+(difference_type offset) const {
+        const_iterator temp = *this;
+        return temp += offset;
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::const_iterator Deque<T, Allocator>::const_iterator::operator-(difference_type offset) const {
+        const_iterator temp = *this;
+        return temp -= offset;
+    }
+
+    template<typename T, typename Allocator>
+    const T& Deque<T, Allocator>::const_iterator::operator*() const {
+        return get();
+    }
+
+    template<typename T, typename Allocator>
+    const T* Deque<T, Allocator>::const_iterator::operator->() const {
+        return m_current;
+    }
+
+    template<typename T, typename Allocator>
+    const T& Deque<T, Allocator>::const_iterator::operator[](difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    // protected member function
+    template<typename T, typename Allocator>
+    T &Deque<T, Allocator>::const_iterator::get() const {
+        return *m_current;
+    }
+
+    template<typename T, typename Allocator>
+    bool Deque<T, Allocator>::const_iterator::operator==(const const_iterator &other) const {
+        return m_current == other.m_current && m_slot == other.m_slot;
+    }
+
+    template<typename T, typename Allocator>
+    bool Deque<T, Allocator>::const_iterator::operator!=(const const_iterator &other) const {
+        return !(*this == other);
+    }
+
+    template<typename T, typename Allocator>
+    bool Deque<T, Allocator>::const_iterator::operator<(const const_iterator &other) const {
+        return m_slot == other.m_slot ? m_current < other.m_current : m_slot < other.m_slot;
+    }
+
+    template<typename T, typename Allocator>
+    bool Deque<T, Allocator>::const_iterator::operator>(const const_iterator &other) const {
+        return other < *this;
+    }
+
+    template<typename T, typename Allocator>
+    bool Deque<T, Allocator>::const_iterator::operator<=(const const_iterator &other) const {
+        return !(other < *this);
+    }
+
+    template<typename T, typename Allocator>
+    bool Deque<T, Allocator>::const_iterator::operator>=(const const_iterator &other) const {
+        return !(*this < other);
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::const_iterator::difference_type
+    Deque<T, Allocator>::const_iterator::operator-(const const_iterator &other) const {
+        if (m_slot == other.m_slot){
+            return m_current - other.m_current;
+        }
+        return (m_slot - other.m_slot) * static_cast<difference_type>(block_size)
+            + (m_current - m_block) - (other.m_current - other.m_block);
+    }
+
+    //-------------- class iterator implementation--------//
+    template<typename T, typename Allocator>
+    Deque<T, Allocator>::iterator::iterator() :const_iterator{} {}
+
+    //private constructor
+    template<typename T, typename Allocator>
+    Deque<T, Allocator>::iterator::iterator(T **slot, std::size_t index) :const_iterator{slot, index} {}
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::iterator &Deque<T, Allocator>::iterator::operator++(){
+        const_iterator::operator++();
+        return *this;
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::iterator Deque<T, Allocator>::iterator::operator++(int){
+        iterator temp = *this;
+        const_iterator::operator++();
+        return temp;
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::iterator &Deque<T, Allocator>::iterator::operator--(){
+        const_iterator::operator--();
+        return *this;
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::iterator Deque<T, Allocator>::iterator::operator--(int){
+        iterator temp = *this;
+        const_iterator::operator--();
+        return temp;
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::iterator &Deque<T, Allocator>::iterator::operator+=(difference_type offset){
+        const_iterator::operator+=(offset);
+        return *this;
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::iterator &Deque<T, Allocator>::iterator::operator-=(difference_type offset){
+        const_iterator::operator-=(offset);
+        return *this;
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::iterator Deque<T, Allocator>::iterator::operator+(difference_type offset) const {
+        iterator temp = *this;
+        return temp += offset;
+    }
+
+    template<typename T, typename Allocator>
+    typename Deque<T, Allocator>::iterator Deque<T, Allocator>::iterator::operator-(difference_type offset) const {
+        iterator temp = *this;
+        return temp -= offset;
+    }
+
+    template<typename T, typename Allocator>
+    T &Deque<T, Allocator>::iterator::operator*() const {
+        return const_iterator::get();
+    }
+
+    template<typename T, typename Allocator>
+    T *Deque<T, Allocator>::iterator::operator->() const {
+        return this->m_current;
+    }
+
+    template<typename T, typename Allocator>
+    T &Deque<T, Allocator>::iterator::operator[](difference_type offset) const {
+        return *(*this + offset);
+    }
+
+} // namespace container
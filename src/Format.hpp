@@ -0,0 +1,256 @@
+#pragma once
+
+#include <charconv>
+#include <functional>
+#include <cstddef>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace container {
+
+    // Which elements a dump shows: the first `head` and the last `tail`, with
+    // a line counting the ones left out between them. All of them by default.
+    struct Summary {
+        static constexpr std::size_t all = static_cast<std::size_t>(-1);
+        std::size_t head = all;
+        std::size_t tail = 0;
+    };
+
+    // Character buffer the containers format their elements into. Arithmetic
+    // values are written with std::to_chars and read as operator<< with the
+    // default stream flags prints them. Without a sink the buffer grows and
+    // holds the whole text; with one it hands its text to the sink each time
+    // it is full and on flush(), so it can be reused for dumps of any size.
+    class Text_buffer {
+    public:
+        using Sink = std::function<void(const char *, std::size_t)>;
+
+        explicit Text_buffer(std::size_t capacity = 1 << 12);
+        explicit Text_buffer(Sink sink, std::size_t capacity = 1 << 14);
+
+        void append(std::string_view text);
+        void append(char c);
+        template<typename T>
+        void append_value(const T &value);
+        void set_precision(int precision) noexcept; // significant digits of floating point values, 6 by default
+
+        void flush(); // hands the text to the sink, if there is one
+        void clear() noexcept;
+        std::string_view view() const noexcept; // text not handed to the sink yet
+        std::string take(); // moves the text out, the buffer is left empty
+
+    private: // members
+        std::string m_text;
+        std::size_t m_capacity;
+        Sink m_sink;
+        int m_precision;
+    };
+
+    namespace detail {
+        template<class It, class = void>
+        struct is_random_access : std::false_type {};
+
+        template<class It>
+        struct is_random_access<It, std::void_t<decltype(std::declval<It &>() += std::ptrdiff_t())>> : std::true_type {};
+
+        // Moves first count elements ahead, in one step when the iterator allows it
+        template<class It>
+        void skip(It &first, std::size_t count) {
+            if constexpr (is_random_access<It>::value){
+                first += static_cast<std::ptrdiff_t>(count);
+            } else {
+                for (; count > 0; --count){
+                    ++first;
+                }
+            }
+        }
+
+        // Elements of [first, first + size) as shown by a Summary: fn(index, element)
+        // for the kept ones and skipped(count) once for the ones left out
+        template<class It, class Fn, class Skipped>
+        void for_each_summarized(It first, std::size_t size, const Summary &summary, Fn fn, Skipped skipped) {
+            if (summary.head >= size || summary.tail >= size - summary.head){
+                for (std::size_t index = 0; index < size; ++index, ++first){
+                    fn(index, *first);
+                }
+                return;
+            }
+            std::size_t index = 0;
+            for (; index < summary.head; ++index, ++first){
+                fn(index, *first);
+            }
+            const std::size_t left_out = size - summary.head - summary.tail;
+            skipped(left_out);
+            skip(first, left_out);
+            for (index += left_out; index < size; ++index, ++first){
+                fn(index, *first);
+            }
+        }
+
+        // true when os prints like a default constructed stream apart from its
+        // precision, so Text_buffer gives the same text
+        inline bool default_format(const std::ostream &os) {
+            const auto flags = os.flags() & ~(std::ios_base::skipws | std::ios_base::unitbuf);
+            return flags == std::ios_base::dec && os.width() == 0;
+        }
+    } // namespace detail
+
+    // Room for a format_table dump, so the buffer of toString is allocated once
+    // for elements of up to ~12 characters
+    inline std::size_t table_capacity(std::string_view name, std::size_t size, const Summary &summary = Summary()) {
+        const std::size_t shown = summary.head >= size || summary.tail >= size - summary.head ? size : summary.head + summary.tail + 1;
+        return 64 + 2 * name.size() + 24 * shown;
+    }
+
+    // The toString layout of the containers:
+    //   \n<===== Kind: name ======>\n >>Size:n\n [0]=> a ... \n<=== End name ====>\n
+    // The size line is left out when show_size is false.
+    template<class It>
+    void format_table(Text_buffer &buffer, std::string_view kind, std::string_view name, It first,
+                      std::size_t size, const Summary &summary = Summary(), bool show_size = true) {
+        buffer.append("\n<===== ");
+        buffer.append(kind);
+        buffer.append(": ");
+        buffer.append(name);
+        buffer.append(" ======>");
+        if (show_size){
+            buffer.append("\n >>Size:");
+            buffer.append_value(size);
+        }
+        detail::for_each_summarized(first, size, summary, [&buffer](std::size_t index, const auto &element){
+            buffer.append("\n [");
+            buffer.append_value(index);
+            buffer.append("]=> ");
+            buffer.append_value(element);
+        }, [&buffer](std::size_t left_out){
+            buffer.append("\n ... ");
+            buffer.append_value(left_out);
+            buffer.append(" more");
+        });
+        buffer.append("\n<=== End ");
+        buffer.append(name);
+        buffer.append(" ====>\n");
+    }
+
+    // The operator<< layout of the containers: every element followed by
+    // separator, then terminator. Streams with non-default flags (hex,
+    // fixed, a width...) get the elements through their own operator<<.
+    template<class It>
+    std::ostream &format_inline(std::ostream &os, It first, std::size_t size, std::string_view separator, std::string_view terminator) {
+        if (!detail::default_format(os)){
+            for (std::size_t index = 0; index < size; ++index, ++first){
+                os << *first << separator;
+            }
+            return os << terminator;
+        }
+        Text_buffer buffer([&os](const char *text, std::size_t count){
+            os.write(text, static_cast<std::streamsize>(count));
+        });
+        buffer.set_precision(static_cast<int>(os.precision()));
+        for (std::size_t index = 0; index < size; ++index, ++first){
+            buffer.append_value(*first);
+            buffer.append(separator);
+        }
+        buffer.append(terminator);
+        buffer.flush();
+        return os;
+    }
+
+//-------------- Class Text_buffer Implementation ------------//
+    inline Text_buffer::Text_buffer(std::size_t capacity)
+        :m_text{}, m_capacity{capacity}, m_sink{}, m_precision{6} {
+        m_text.reserve(capacity);
+    }
+
+    inline Text_buffer::Text_buffer(Sink sink, std::size_t capacity)
+        :m_text{}, m_capacity{capacity ? capacity : 1}, m_sink{std::move(sink)}, m_precision{6} {
+        m_text.reserve(m_capacity);
+    }
+
+    inline void Text_buffer::append(std::string_view text){
+        if (m_sink && m_text.size() + text.size() > m_capacity){
+            flush();
+            if (text.size() >= m_capacity){
+                m_sink(text.data(), text.size());
+                return;
+            }
+        }
+        m_text.append(text.data(), text.size());
+    }
+
+    inline void Text_buffer::append(char c){
+        if (m_sink && m_text.size() == m_capacity){
+            flush();
+        }
+        m_text.push_back(c);
+    }
+
+    // characters are written as characters and bool as 0 or 1, as streams do
+    template<typename T>
+    void Text_buffer::append_value(const T &value){
+        if constexpr (std::is_same<T, bool>::value){
+            append(value ? '1' : '0');
+        } else if constexpr (std::is_same<T, char>::value || std::is_same<T, signed char>::value || std::is_same<T, unsigned char>::value){
+            append(static_cast<char>(value));
+        } else if constexpr (std::is_integral<T>::value && !std::is_same<T, wchar_t>::value &&
+                             !std::is_same<T, char16_t>::value && !std::is_same<T, char32_t>::value){
+            char digits[24];
+            const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+            append(std::string_view(digits, static_cast<std::size_t>(result.ptr - digits)));
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        } else if constexpr (std::is_floating_point<T>::value){
+            // %g with m_precision significant digits, the default float format of streams
+            char digits[64];
+            auto result = std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::general, m_precision);
+            if (result.ec == std::errc()){
+                append(std::string_view(digits, static_cast<std::size_t>(result.ptr - digits)));
+            } else {
+                std::ostringstream stream;
+                stream.precision(m_precision);
+                stream << value;
+                append(stream.str());
+            }
+#endif
+        } else if constexpr (std::is_convertible<const T &, std::string_view>::value){
+            append(std::string_view(value));
+        } else {
+            // other types through their operator<<, one reused stream per thread
+            thread_local std::ostringstream stream;
+            stream.str(std::string());
+            stream.clear();
+            stream.precision(m_precision);
+            stream << value;
+            append(stream.str());
+        }
+    }
+
+    inline void Text_buffer::set_precision(int precision) noexcept {
+        m_precision = precision;
+    }
+
+    inline void Text_buffer::flush(){
+        if (m_sink && !m_text.empty()){
+            m_sink(m_text.data(), m_text.size());
+            m_text.clear();
+        }
+    }
+
+    inline void Text_buffer::clear() noexcept {
+        m_text.clear();
+    }
+
+    inline std::string_view Text_buffer::view() const noexcept {
+        return m_text;
+    }
+
+    inline std::string Text_buffer::take(){
+        std::string text = std::move(m_text);
+        m_text = std::string();
+        return text;
+    }
+
+} // namespace container
@@ -4,30 +4,45 @@
 #include <stdexcept>
 #include <initializer_list>
 #include <sstream>
+#include <memory>
+#include <utility>
+#include <functional>
+#include "Format.hpp"
+#include "Stats.hpp"
+
 namespace container {
-	template <typename T>
+	template <typename T, typename Allocator = std::allocator<T>>
 	class Forward_list {
 			// Node of the list
 			struct Node{
-				Node() 
-					:value{T{}}, next{nullptr} {};
-				Node(const T &val, Node* next_) 
-					:value{val}, next{next_}{}
+				template<class... Args>
+				Node(Node* next_, Args&&... args)
+					:value(std::forward<Args>(args)...), next{next_} {}
 				
-				T value{};
+				T value;
 				Node *next;
 			};
 
+			// allocator rebound to the node type
+			using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+			using node_traits = std::allocator_traits<node_allocator>;
+			using recorder = stats::Recorder<Forward_list>; // operation counters, empty unless CONTAINER_STATS
+
 		public:
+			using value_type = T;
+			using allocator_type = Allocator;
+
 			// Constructors, destructor, assignment operators
 			Forward_list(); 
-			Forward_list(std::initializer_list<T> init);
+			explicit Forward_list(const Allocator &alloc);
+			Forward_list(std::initializer_list<T> init, const Allocator &alloc = Allocator());
 			Forward_list(const Forward_list &list); //copy constructor
 			Forward_list(Forward_list && list) noexcept; // move constructor
 			virtual ~Forward_list();
 			
-			Forward_list<T> &operator=(const Forward_list &list);// applies copy and swap idiom
-			Forward_list<T> &operator=(Forward_list &&list) noexcept; // applies copy and swap idiom
+			Forward_list<T, Allocator> &operator=(const Forward_list &list);// applies copy and swap idiom
+			Forward_list<T, Allocator> &operator=(Forward_list &&list) noexcept; // applies copy and swap idiom
+			allocator_type get_allocator() const;
 			
 			// Element access
 			T &operator[](const std::size_t index);
@@ -54,14 +69,20 @@ namespace container {
 			std::size_t size()const;
 			
 			// Modifiers
+			template<class... Args>
+			iterator emplace_after(const_iterator it, Args&&... args);
+			template<class... Args>
+			T &emplace_front(Args&&... args);
+			template<class... Args>
+			T &emplace_back(Args&&... args);
 			iterator insert_after(const_iterator it, const T &value);
-			iterator insert_after(const_iterator it, T &&value) noexcept;
+			iterator insert_after(const_iterator it, T &&value);
 			void push_front(const T &value);
-			void push_front(T &&value) noexcept;
+			void push_front(T &&value);
 			void push_mid(const T &value);
-			void push_mid(T &&value) noexcept;
+			void push_mid(T &&value);
 			void push_back(const T &value);
-			void push_back(T &&value) noexcept;
+			void push_back(T &&value);
 			iterator erase_after(const_iterator it);
 			iterator erase_after(const std::size_t index);
 			void pop_front();
@@ -69,62 +90,102 @@ namespace container {
 			void swap(Forward_list &list) noexcept;
 
 			//Operations
+			void splice_after(const_iterator pos, Forward_list &other);
+			void splice_after(const_iterator pos, Forward_list &&other);
+			void splice_after(const_iterator pos, Forward_list &other, const_iterator it);
+			void splice_after(const_iterator pos, Forward_list &other, const_iterator first, const_iterator last);
+			void merge(Forward_list &other);
+			void merge(Forward_list &&other);
+			template<class Compare>
+			void merge(Forward_list &other, Compare comp);
+			void sort();
+			template<class Compare>
+			void sort(Compare comp);
+			std::size_t unique();
+			template<class BinaryPredicate>
+			std::size_t unique(BinaryPredicate pred);
+			template<class UnaryPredicate>
+			std::size_t remove_if(UnaryPredicate pred);
+			void reverse() noexcept;
 			std::string toString(const std::string & name = "") const;
+			std::string toString(const std::string &name, const Summary &summary) const;
+			void format_to(Text_buffer &buffer, const std::string &name = "", const Summary &summary = Summary()) const;
 
 		private:
-			Node *head; //member
+			std::size_t m_size; //members
+			Node *head;
+			Node *tail; // last node, nullptr when empty
+			node_allocator m_alloc;
 			
 			// helpers
 			Node *seek(const std::size_t index) noexcept;
 			Node *before_end();
+			template<class... Args>
+			Node *create_node(Node *next, Args&&... args);
+			void destroy_node(Node *node) noexcept;
 
 			template<class U>
 			void push_back_items(const U &items);
+			void check_allocator(const Forward_list &other) const;
+			Node *next_of(Node *pos) const noexcept;
+			void link_after(Node *pos, Node *first, Node *last, std::size_t count) noexcept;
+			void unlink_after(Node *pos, Node *last, std::size_t count) noexcept;
+			template<class Compare>
+			static Node *merge_chains(Node *left, Node *right, Compare &comp);
 	};
 
 //-------------- Class List Implementation --------------//
 	// Constructors, destructor assign operator //
-	template <typename T>
-	Forward_list<T>::Forward_list() :head{nullptr} {}
+	template <typename T, typename Allocator>
+	Forward_list<T, Allocator>::Forward_list() :Forward_list{Allocator()} {}
+
+	template <typename T, typename Allocator>
+	Forward_list<T, Allocator>::Forward_list(const Allocator &alloc) :m_size{0}, head{nullptr}, tail{nullptr}, m_alloc{alloc} {}
 	
-	template <typename T>
-	Forward_list<T>::Forward_list(std::initializer_list<T> init) :head{nullptr} {
+	template <typename T, typename Allocator>
+	Forward_list<T, Allocator>::Forward_list(std::initializer_list<T> init, const Allocator &alloc) :Forward_list{alloc} {
 		push_back_items(init);
 	}
 
-	template <typename T>
-	Forward_list<T>::Forward_list(const Forward_list &list) :head{nullptr}{
+	template <typename T, typename Allocator>
+	Forward_list<T, Allocator>::Forward_list(const Forward_list &list)
+		:Forward_list{std::allocator_traits<Allocator>::select_on_container_copy_construction(list.get_allocator())} {
 		push_back_items(list);	
 	}
 
-	template <typename T>
-	Forward_list<T>::Forward_list(Forward_list &&list) noexcept :head{nullptr}{
+	template <typename T, typename Allocator>
+	Forward_list<T, Allocator>::Forward_list(Forward_list &&list) noexcept :Forward_list{list.get_allocator()} {
 		swap(list);
 	}
 
-	template <typename T>
-	Forward_list<T>::~Forward_list(){
+	template <typename T, typename Allocator>
+	Forward_list<T, Allocator>::~Forward_list(){
 		clear();
 	}
 
-	template<typename T>
-	Forward_list<T>& Forward_list<T>::operator=(const Forward_list<T> &list) {
+	template<typename T, typename Allocator>
+	Forward_list<T, Allocator>& Forward_list<T, Allocator>::operator=(const Forward_list &list) {
 		if (this != &list){
 			auto temp(list);
-			swap(list);
+			swap(temp);
 		}
 		return *this;
 	}
 
-	template<typename T>
-	Forward_list<T>& Forward_list<T>::operator=(Forward_list<T> &&list) noexcept {
+	template<typename T, typename Allocator>
+	Forward_list<T, Allocator>& Forward_list<T, Allocator>::operator=(Forward_list &&list) noexcept {
 		swap(list);
 		return *this;
 	}
 
+	template<typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::allocator_type Forward_list<T, Allocator>::get_allocator() const {
+		return allocator_type(m_alloc);
+	}
+
 	//--------------- Element access ---------------//
-	template<typename T>
-	T& Forward_list<T>::operator[](const std::size_t index) {
+	template<typename T, typename Allocator>
+	T& Forward_list<T, Allocator>::operator[](const std::size_t index) {
 		auto it = seek(index);
 		if (!it) {
 			throw std::out_of_range("ERROR: Index out of bounds in forward_list");
@@ -132,211 +193,310 @@ namespace container {
 		return it->value;
 	}
 
-	template<typename T>
-	const T& Forward_list<T>::operator[](const std::size_t index) const {
-		return operator[](index);
+	template<typename T, typename Allocator>
+	const T& Forward_list<T, Allocator>::operator[](const std::size_t index) const {
+		return const_cast<Forward_list &>(*this)[index];
 	}
 
 	// private member function
-	template<typename T>
-	typename Forward_list<T>::Node *Forward_list<T>::seek(const std::size_t index) noexcept {
+	template<typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::Node *Forward_list<T, Allocator>::seek(const std::size_t index) noexcept {
+		if (index >= m_size) {
+			return nullptr;
+		}
+		recorder::walked(index);
 		Node *temp = head;
-		for (std::size_t i = 0; i < index && head->next ; ++i) {
+		for (std::size_t i = 0; i < index; ++i) {
 			temp = temp->next;
 		}
 		return temp;
 	}
 
 	// private member function
-	template<typename T>
-	typename Forward_list<T>::Node *Forward_list<T>::before_end(){
-		auto it = head;
-		while (it && it->next){
-			it = it->next;
+	template<typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::Node *Forward_list<T, Allocator>::before_end(){
+		return tail;
+	}
+
+	// private member function
+	template<typename T, typename Allocator>
+	template<class... Args>
+	typename Forward_list<T, Allocator>::Node *Forward_list<T, Allocator>::create_node(Node *next, Args&&... args) {
+		Node *node = node_traits::allocate(m_alloc, 1);
+		try {
+			node_traits::construct(m_alloc, node, next, std::forward<Args>(args)...);
+		} catch (...) {
+			node_traits::deallocate(m_alloc, node, 1);
+			throw;
 		}
-		return it;
+		recorder::allocation(sizeof(Node));
+		recorder::template constructed<T, Args...>(1);
+		return node;
 	}
 
 	// private member function
-	template<typename T>
+	template<typename T, typename Allocator>
+	void Forward_list<T, Allocator>::destroy_node(Node *node) noexcept {
+		node_traits::destroy(m_alloc, node);
+		node_traits::deallocate(m_alloc, node, 1);
+		recorder::deallocation();
+	}
+
+	// private member function
+	template<typename T, typename Allocator>
 	template<class U>
-	void Forward_list<T>::push_back_items(const U &items){
+	void Forward_list<T, Allocator>::push_back_items(const U &items){
 		auto it = items.begin();
-		if (it != items.end()){
-			auto tail = head = new Node{std::move(*it++),nullptr};
-			for (; it != items.end(); ++it) {
-				insert_after(const_iterator{tail}, *it);
-				tail= tail->next;	
+		for (; it != items.end(); ++it) {
+			emplace_back(*it);
+		}
+	}
+
+	// private member function, nodes only change lists when either allocator can free them
+	template<typename T, typename Allocator>
+	void Forward_list<T, Allocator>::check_allocator(const Forward_list &other) const {
+		if (!node_traits::is_always_equal::value && !(m_alloc == other.m_alloc)) {
+			throw std::runtime_error("ERROR: Splicing between lists with unequal allocators");
+		}
+	}
+
+	// private member function, the node after pos, a null pos being before_begin()
+	template<typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::Node *Forward_list<T, Allocator>::next_of(Node *pos) const noexcept {
+		return pos ? pos->next : head;
+	}
+
+	// private member function, links the detached chain first..last of count nodes after pos
+	template<typename T, typename Allocator>
+	void Forward_list<T, Allocator>::link_after(Node *pos, Node *first, Node *last, std::size_t count) noexcept {
+		Node *&link = pos ? pos->next : head;
+		last->next = link;
+		link = first;
+		if (!last->next) {
+			tail = last;
+		}
+		m_size += count;
+		recorder::size(m_size);
+	}
+
+	// private member function, detaches the count nodes following pos up to last (inclusive)
+	template<typename T, typename Allocator>
+	void Forward_list<T, Allocator>::unlink_after(Node *pos, Node *last, std::size_t count) noexcept {
+		Node *&link = pos ? pos->next : head;
+		link = last->next;
+		if (tail == last) {
+			tail = pos;
+		}
+		m_size -= count;
+	}
+
+	// private member function, stable merge of two sorted null terminated chains
+	template<typename T, typename Allocator>
+	template<class Compare>
+	typename Forward_list<T, Allocator>::Node *Forward_list<T, Allocator>::merge_chains(Node *left, Node *right, Compare &comp) {
+		Node *merged = nullptr;
+		Node **link = &merged;
+		while (left && right) {
+			if (comp(right->value, left->value)) {
+				*link = right;
+				right = right->next;
+			} else {
+				*link = left;
+				left = left->next;
 			}
+			link = &(*link)->next;
 		}
+		*link = left ? left : right;
+		return merged;
 	}
 
 	//-----------------  Iterators -----------------//
-	template<typename T>
-	typename Forward_list<T>::iterator Forward_list<T>::before_begin() noexcept { 
+	template<typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::iterator Forward_list<T, Allocator>::before_begin() noexcept { 
 		return iterator{nullptr}; 
 	}
 
-	template<typename T>
-	typename Forward_list<T>::const_iterator Forward_list<T>::before_begin() const noexcept { 
-		return cbegin(); 
+	template<typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::const_iterator Forward_list<T, Allocator>::before_begin() const noexcept { 
+		return cbefore_begin(); 
 	}
 
-	template<typename T>
-	typename Forward_list<T>::const_iterator Forward_list<T>::cbefore_begin() const noexcept { 
+	template<typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::const_iterator Forward_list<T, Allocator>::cbefore_begin() const noexcept { 
 		return const_iterator{nullptr}; 
 	}
 
-	template<typename T>
-	typename Forward_list<T>::iterator Forward_list<T>::begin() noexcept { 
+	template<typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::iterator Forward_list<T, Allocator>::begin() noexcept { 
 		return iterator{head}; 
 	}
 
-	template<typename T>
-	typename Forward_list<T>::const_iterator Forward_list<T>::begin() const noexcept { 
+	template<typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::const_iterator Forward_list<T, Allocator>::begin() const noexcept { 
 		return cbegin(); 
 	}
 
-	template<typename T>
-	typename Forward_list<T>::const_iterator Forward_list<T>::cbegin() const noexcept { 
+	template<typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::const_iterator Forward_list<T, Allocator>::cbegin() const noexcept { 
 		return const_iterator{head}; 
 	}
 
-	template<typename T>
-	typename Forward_list<T>::iterator Forward_list<T>::end() noexcept { 
+	template<typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::iterator Forward_list<T, Allocator>::end() noexcept { 
 		return iterator{}; 
 	}
 
-	template<typename T>
-	typename Forward_list<T>::const_iterator Forward_list<T>::end() const noexcept{ 
+	template<typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::const_iterator Forward_list<T, Allocator>::end() const noexcept{ 
 		return cend(); 
 	}
 
-	template<typename T>
-	typename Forward_list<T>::const_iterator Forward_list<T>::cend() const noexcept{ 
+	template<typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::const_iterator Forward_list<T, Allocator>::cend() const noexcept{ 
 		return const_iterator{};
 	}
 	
 	//-----------------  Capacity ------------------//
-	template<typename T>
-	std::size_t Forward_list<T>::size() const {
-		auto temp = head; 
-		std::size_t size = 0;
-		while (temp){
-			++size;
-			temp = temp->next;
-		}
-		return size; 
+	template<typename T, typename Allocator>
+	std::size_t Forward_list<T, Allocator>::size() const {
+		return m_size;
 	}
 
-	template<typename T>
-	bool Forward_list<T>::empty() const{
+	template<typename T, typename Allocator>
+	bool Forward_list<T, Allocator>::empty() const{
 		return head == nullptr; 
 	}
 
 	//-----------------  Modifiers -----------------//
-	template <typename T>
-	typename Forward_list<T>::iterator Forward_list<T>::insert_after(const_iterator it, const T &value){
-		if (it == nullptr) {
-			throw std::runtime_error("ERROR: Empty or null Iterator");
-		}
-		
-		if (!head){
-			push_front(value);
+	template <typename T, typename Allocator>
+	template <class... Args>
+	typename Forward_list<T, Allocator>::iterator Forward_list<T, Allocator>::emplace_after(const_iterator it, Args&&... args){
+		Node *after_node =  it.current_node;
+		if (!after_node || !head){ // before_begin() or empty list
+			emplace_front(std::forward<Args>(args)...);
 			return iterator{head};
 		}
 
-		Node *after_node =  it.current_node;
-		Node *new_node = new Node(value, after_node->next);
+		Node *new_node = create_node(after_node->next, std::forward<Args>(args)...);
 		after_node->next = new_node;
+		if (after_node == tail){
+			tail = new_node;
+		}
+		++m_size;
+		recorder::size(m_size);
 		return iterator{new_node};
 	}
 
-	template <typename T>
-	typename Forward_list<T>::iterator Forward_list<T>::insert_after(const_iterator it, T &&value) noexcept {
-		if (!head){
-			push_front(std::move(value));
-			return iterator{head};
+	template <typename T, typename Allocator>
+	template <class... Args>
+	T &Forward_list<T, Allocator>::emplace_front(Args&&... args){
+		head = create_node(head, std::forward<Args>(args)...);
+		if (!tail){
+			tail = head;
 		}
+		++m_size;
+		recorder::size(m_size);
+		return head->value;
+	}
 
-		Node *after_node =  it.current_node;
-		Node *new_node = new Node(std::move(value), after_node->next);
-		after_node->next = new_node;
-		return iterator{new_node};
+	template <typename T, typename Allocator>
+	template <class... Args>
+	T &Forward_list<T, Allocator>::emplace_back(Args&&... args){
+		return *emplace_after(const_iterator(before_end()), std::forward<Args>(args)...);
+	}
+
+	template <typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::iterator Forward_list<T, Allocator>::insert_after(const_iterator it, const T &value){
+		return emplace_after(it, value);
 	}
 
-	template <typename T>
-	void Forward_list<T>::push_front(const T &value) {
-		auto new_node = new Node{value, head};
-		head = new_node;
+	template <typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::iterator Forward_list<T, Allocator>::insert_after(const_iterator it, T &&value) {
+		return emplace_after(it, std::move(value));
 	}
 
-	template <typename T>
-	void Forward_list<T>::push_front(T &&value) noexcept {
-		auto new_node = new Node{std::move(value), head};
-		head = new_node;
+	template <typename T, typename Allocator>
+	void Forward_list<T, Allocator>::push_front(const T &value) {
+		emplace_front(value);
 	}
 
-	template <typename T>
-	void Forward_list<T>::push_mid(const T &value) {
+	template <typename T, typename Allocator>
+	void Forward_list<T, Allocator>::push_front(T &&value) {
+		emplace_front(std::move(value));
+	}
+
+	template <typename T, typename Allocator>
+	void Forward_list<T, Allocator>::push_mid(const T &value) {
 		if(!empty()){
-			insert_after(const_iterator(seek(size() / 2 - 1)), value); 
+			insert_after(const_iterator(seek(m_size > 1 ? m_size / 2 - 1 : 0)), value); 
 		}else {
 			push_front(value);
 		}
 	}
 
-	template <typename T>
-	void Forward_list<T>::push_mid(T &&value) noexcept {
+	template <typename T, typename Allocator>
+	void Forward_list<T, Allocator>::push_mid(T &&value) {
 		if(!empty()){
-			insert_after (const_iterator(seek(size() / 2 - 1)), std::move(value)); 
+			insert_after (const_iterator(seek(m_size > 1 ? m_size / 2 - 1 : 0)), std::move(value)); 
 		}else {
 			push_front(std::move(value));
 		}
 	}
 
-	template <typename T>
-	void Forward_list<T>::push_back(const T &value) {
+	template <typename T, typename Allocator>
+	void Forward_list<T, Allocator>::push_back(const T &value) {
 		insert_after(const_iterator(before_end()), value); 
 	}
 
-	template <typename T>
-	void Forward_list<T>::push_back(T &&value) noexcept {
+	template <typename T, typename Allocator>
+	void Forward_list<T, Allocator>::push_back(T &&value) {
 		insert_after(const_iterator(before_end()), std::move(value)); 
 	}
 
-	template <typename T>
-	typename Forward_list<T>::iterator Forward_list<T>::erase_after(const_iterator it){
+	template <typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::iterator Forward_list<T, Allocator>::erase_after(const_iterator it){
 		Node *current = it.current_node;
 		Node *to_return = nullptr;
 		
 		if (current && current->next){
-			 auto to_delete = current->next;
-			 to_return = current->next = current->next->next;
-			 delete to_delete;
+			auto to_delete = current->next;
+			to_return = current->next = current->next->next;
+			if (to_delete == tail){
+				tail = current;
+			}
+			destroy_node(to_delete);
+			--m_size;
 		} else if(!current && head){
 			auto to_delete = head;
 			to_return = head = head->next;
-			delete to_delete; 
+			if (to_delete == tail){
+				tail = nullptr;
+			}
+			destroy_node(to_delete);
+			--m_size;
 		}
 		return iterator{to_return};
 	}
 
-	template <typename T>
-	typename Forward_list<T>::iterator Forward_list<T>::erase_after(const std::size_t index) {
-		return erase_after(const_iterator(seek(index)));
+	template <typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::iterator Forward_list<T, Allocator>::erase_after(const std::size_t index) {
+		auto node = seek(index);
+		if (!node) {
+			throw std::out_of_range("ERROR: Index out of bounds in forward_list");
+		}
+		return erase_after(const_iterator(node));
 	}
 
-	template <typename T>
-	void Forward_list<T>::pop_front() {
+	template <typename T, typename Allocator>
+	void Forward_list<T, Allocator>::pop_front() {
 		if (empty()) { 
 			throw std::runtime_error("ERROR: Empty container");
 		}
 		erase_after(before_begin());
 	}
 
-	template<typename T>
-	void Forward_list<T>::clear() {
+	template<typename T, typename Allocator>
+	void Forward_list<T, Allocator>::clear() {
 		if (!head) {
 			return;
 		}
@@ -345,47 +505,225 @@ namespace container {
 		while (head->next) {
 			prev = head;
 			head = head->next;
-			delete prev;
+			destroy_node(prev);
 		}
-		delete head;
+		destroy_node(head);
 
-		head = nullptr;
+		head = tail = nullptr;
+		m_size = 0;
 	}
 
-	template <typename T>
-	void Forward_list<T>::swap(Forward_list &list) noexcept {
-		auto temp = head;
-		head = list.head;
-		list.head = temp;
+	template <typename T, typename Allocator>
+	void Forward_list<T, Allocator>::swap(Forward_list &list) noexcept {
+		std::swap(head, list.head);
+		std::swap(tail, list.tail);
+		std::swap(m_size, list.m_size);
+		if constexpr (node_traits::propagate_on_container_swap::value){
+			std::swap(m_alloc, list.m_alloc);
+		}
 	}
 
 	//-----------------  Operations -----------------//
-	template<typename T>
-	std::string Forward_list<T>::toString(const std::string & name) const{
-		std::stringstream stream;
-		stream << "\n<===== Forward List: " << name << " ======>";
-		std::size_t index = 0;
-		for (const auto &it : *this) {
-			stream << "\n [" << index++ << "]=> " << it ;
+	template<typename T, typename Allocator>
+	void Forward_list<T, Allocator>::splice_after(const_iterator pos, Forward_list &other) {
+		if (this == &other || other.empty()) {
+			return;
 		}
-		stream << "\n<=== End " << name << " ====>\n";
-		return stream.str();
+		check_allocator(other);
+
+		Node *first = other.head;
+		Node *last = other.tail;
+		std::size_t count = other.m_size;
+		other.unlink_after(nullptr, last, count);
+		link_after(pos.current_node, first, last, count);
 	}
 
-	//---------------- Non-member functions ----------------//
-	template<typename T>
-	std::ostream& operator<<(std::ostream& os, const Forward_list<T> & list) {
-		for (const auto &it : list) {
-			os << it << "->";
+	template<typename T, typename Allocator>
+	void Forward_list<T, Allocator>::splice_after(const_iterator pos, Forward_list &&other) {
+		splice_after(pos, other);
+	}
+
+	// moves the element following it
+	template<typename T, typename Allocator>
+	void Forward_list<T, Allocator>::splice_after(const_iterator pos, Forward_list &other, const_iterator it) {
+		Node *node = other.next_of(it.current_node);
+		if (!node || node == pos.current_node || (this == &other && pos == it)) {
+			return;
 		}
-		os << "NULL";
+		check_allocator(other);
 
-		return os;
+		other.unlink_after(it.current_node, node, 1);
+		link_after(pos.current_node, node, node, 1);
+	}
+
+	// moves the elements between first and last (both excluded), counting them on the way
+	template<typename T, typename Allocator>
+	void Forward_list<T, Allocator>::splice_after(const_iterator pos, Forward_list &other, const_iterator first, const_iterator last) {
+		Node *front = other.next_of(first.current_node);
+		if (front == last.current_node) {
+			return;
+		}
+		check_allocator(other);
+
+		std::size_t count = 1;
+		Node *back = front;
+		for (; back->next != last.current_node; back = back->next) {
+			++count;
+		}
+		other.unlink_after(first.current_node, back, count);
+		link_after(pos.current_node, front, back, count);
+	}
+
+	template<typename T, typename Allocator>
+	void Forward_list<T, Allocator>::merge(Forward_list &other) {
+		merge(other, std::less<>{});
+	}
+
+	template<typename T, typename Allocator>
+	void Forward_list<T, Allocator>::merge(Forward_list &&other) {
+		merge(other, std::less<>{});
+	}
+
+	// both lists must be sorted by comp; equal elements of *this stay in front
+	template<typename T, typename Allocator>
+	template<class Compare>
+	void Forward_list<T, Allocator>::merge(Forward_list &other, Compare comp) {
+		if (this == &other || other.empty()) {
+			return;
+		}
+		check_allocator(other);
+
+		Node *prev = nullptr;
+		for (Node *current = head; current && other.head;) {
+			Node *node = other.head;
+			if (comp(node->value, current->value)) {
+				other.unlink_after(nullptr, node, 1);
+				link_after(prev, node, node, 1);
+				prev = node;
+			} else {
+				prev = current;
+				current = current->next;
+			}
+		}
+		splice_after(const_iterator{tail}, other);
+	}
+
+	template<typename T, typename Allocator>
+	void Forward_list<T, Allocator>::sort() {
+		sort(std::less<>{});
+	}
+
+	// stable bottom-up merge sort: nodes are relinked, no element is copied
+	// and nothing is allocated. bins[i] holds a sorted run of 2^i nodes.
+	template<typename T, typename Allocator>
+	template<class Compare>
+	void Forward_list<T, Allocator>::sort(Compare comp) {
+		if (m_size < 2) {
+			return;
+		}
+
+		Node *bins[64] = {};
+		for (Node *node = head; node;) {
+			Node *carry = node;
+			node = node->next;
+			carry->next = nullptr;
+
+			std::size_t i = 0;
+			for (; bins[i]; ++i) {
+				carry = merge_chains(bins[i], carry, comp); // older run on the left keeps it stable
+				bins[i] = nullptr;
+			}
+			bins[i] = carry;
+		}
+
+		head = nullptr;
+		for (auto bin : bins) {
+			if (bin) {
+				head = head ? merge_chains(bin, head, comp) : bin;
+			}
+		}
+		for (tail = head; tail->next; tail = tail->next) {}
+	}
+
+	template<typename T, typename Allocator>
+	std::size_t Forward_list<T, Allocator>::unique() {
+		return unique(std::equal_to<>{});
+	}
+
+	// removes every element equal to the one before it
+	template<typename T, typename Allocator>
+	template<class BinaryPredicate>
+	std::size_t Forward_list<T, Allocator>::unique(BinaryPredicate pred) {
+		std::size_t removed = 0;
+		for (Node *node = head; node && node->next;) {
+			if (pred(node->value, node->next->value)) {
+				erase_after(const_iterator{node});
+				++removed;
+			} else {
+				node = node->next;
+			}
+		}
+		return removed;
+	}
+
+	template<typename T, typename Allocator>
+	template<class UnaryPredicate>
+	std::size_t Forward_list<T, Allocator>::remove_if(UnaryPredicate pred) {
+		std::size_t removed = 0;
+		Node *prev = nullptr;
+		for (Node *node = head; node;) {
+			if (pred(node->value)) {
+				node = erase_after(const_iterator{prev}).current_node;
+				++removed;
+			} else {
+				prev = node;
+				node = node->next;
+			}
+		}
+		return removed;
+	}
+
+	// relinks the nodes in the opposite order, no element is moved
+	template<typename T, typename Allocator>
+	void Forward_list<T, Allocator>::reverse() noexcept {
+		Node *prev = nullptr;
+		tail = head;
+		for (Node *node = head; node;) {
+			Node *next = node->next;
+			node->next = prev;
+			prev = node;
+			node = next;
+		}
+		head = prev;
+	}
+
+	template<typename T, typename Allocator>
+	std::string Forward_list<T, Allocator>::toString(const std::string & name) const {
+		return toString(name, Summary());
+	}
+
+	template<typename T, typename Allocator>
+	std::string Forward_list<T, Allocator>::toString(const std::string &name, const Summary &summary) const {
+		Text_buffer buffer(table_capacity(name, m_size, summary));
+		format_to(buffer, name, summary);
+		return buffer.take();
+	}
+
+	// appends the toString text to buffer, which can be reused across dumps
+	template<typename T, typename Allocator>
+	void Forward_list<T, Allocator>::format_to(Text_buffer &buffer, const std::string &name, const Summary &summary) const {
+		format_table(buffer, "Forward List", name, cbegin(), m_size, summary, false);
+	}
+
+	//---------------- Non-member functions ----------------//
+	template<typename T, typename Allocator>
+	std::ostream& operator<<(std::ostream& os, const Forward_list<T, Allocator> & list) {
+		return format_inline(os, list.cbegin(), list.size(), "->", "NULL");
 	}
 
 	//-------------- Inner class const_iterator --------//
-	template <typename T>	
-	class Forward_list<T>::const_iterator {
+	template <typename T, typename Allocator>	
+	class Forward_list<T, Allocator>::const_iterator {
 	public:
 		const_iterator();
 		
@@ -400,12 +738,12 @@ namespace container {
 
 		const_iterator(Node *new_ptr); // constructor
 		T &get() const; // get the value at the iterator current position
-		friend class Forward_list<T>;
+		friend class Forward_list<T, Allocator>;
 	};
 			
 	//-------------- Inner class iterator --------//
-	template <typename T>
-	class Forward_list<T>::iterator final: public const_iterator {
+	template <typename T, typename Allocator>
+	class Forward_list<T, Allocator>::iterator final: public const_iterator {
 	public:
 		iterator();
 
@@ -417,75 +755,75 @@ namespace container {
 
 	private:
 		iterator(Node *new_ptr); // constructor
-		friend class Forward_list<T>;			
+		friend class Forward_list<T, Allocator>;			
 	};
 
 	//-------------- class const_iterator implementation--------//
-	template <typename T>
-	Forward_list<T>::const_iterator::const_iterator() :current_node{nullptr} {}
+	template <typename T, typename Allocator>
+	Forward_list<T, Allocator>::const_iterator::const_iterator() :current_node{nullptr} {}
 
 	//protected constructor
-	template <typename T>
-	Forward_list<T>::const_iterator::const_iterator (Node *new_ptr) :current_node{new_ptr} {}
+	template <typename T, typename Allocator>
+	Forward_list<T, Allocator>::const_iterator::const_iterator (Node *new_ptr) :current_node{new_ptr} {}
 
-	template <typename T>
-	const T &Forward_list<T>::const_iterator::operator*() const{
+	template <typename T, typename Allocator>
+	const T &Forward_list<T, Allocator>::const_iterator::operator*() const{
 		return get();
 	}
 
-	template <typename T>
-	T &Forward_list<T>::const_iterator::get() const{
+	template <typename T, typename Allocator>
+	T &Forward_list<T, Allocator>::const_iterator::get() const{
 		return current_node->value;
 	}
 
-	template <typename T>
-	typename Forward_list<T>::const_iterator &Forward_list<T>::const_iterator::operator++(){ // Prefix
+	template <typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::const_iterator &Forward_list<T, Allocator>::const_iterator::operator++(){ // Prefix
 		current_node = current_node -> next;
 		return *this;
 	}
 
-	template <typename T>
-	typename Forward_list<T>::const_iterator Forward_list<T>::const_iterator::operator++(int){ // Postfix
+	template <typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::const_iterator Forward_list<T, Allocator>::const_iterator::operator++(int){ // Postfix
 		const_iterator temp = *this;
 		++(*this);
 		return temp;
 	}
 
-	template <typename T>
-	bool Forward_list<T>::const_iterator::operator==(const const_iterator &other) const {
+	template <typename T, typename Allocator>
+	bool Forward_list<T, Allocator>::const_iterator::operator==(const const_iterator &other) const {
 		return current_node == other.current_node;
 	}
 
-	template <typename T>
-	bool Forward_list<T>::const_iterator::operator!=(const const_iterator &other) const {
+	template <typename T, typename Allocator>
+	bool Forward_list<T, Allocator>::const_iterator::operator!=(const const_iterator &other) const {
 		return !(*this == other);
 	}
 
 	//-------------- Class iterator implementation --------//
-	template <typename T>
-	Forward_list<T>::iterator::iterator() :const_iterator{} {}
+	template <typename T, typename Allocator>
+	Forward_list<T, Allocator>::iterator::iterator() :const_iterator{} {}
 
-	template <typename T>
-	Forward_list<T>::iterator::iterator(Node *new_ptr)  :const_iterator {new_ptr} {}
+	template <typename T, typename Allocator>
+	Forward_list<T, Allocator>::iterator::iterator(Node *new_ptr)  :const_iterator {new_ptr} {}
 
-	template <typename T>
-	const T &Forward_list<T>::iterator::operator*() const {
+	template <typename T, typename Allocator>
+	const T &Forward_list<T, Allocator>::iterator::operator*() const {
 		return const_iterator::operator*();
 	}
 
-	template <typename T>
-	T &Forward_list<T>::iterator::operator*() {
+	template <typename T, typename Allocator>
+	T &Forward_list<T, Allocator>::iterator::operator*() {
 		return const_iterator::get();
 	}
 
-	template <typename T>
-	typename Forward_list<T>::iterator &Forward_list<T>::iterator::operator++(){
+	template <typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::iterator &Forward_list<T, Allocator>::iterator::operator++(){
 		this->current_node = this->current_node->next;
 		return *this;
 	}
 
-	template <typename T>
-	typename Forward_list<T>::iterator Forward_list<T>::iterator::operator++(int){
+	template <typename T, typename Allocator>
+	typename Forward_list<T, Allocator>::iterator Forward_list<T, Allocator>::iterator::operator++(int){
 		iterator temp = *this;
 		++(*this);
 		return temp;
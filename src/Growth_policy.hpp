@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+
+namespace container {
+
+    // Growth policies decide the next capacity of a Vector that is full.
+    // next_capacity<T>(capacity, required) returns a capacity of at least
+    // `required` elements or throws std::length_error.
+    // reserve_capacity<T>(capacity, requested) is the capacity allocated when
+    // reserve() or a constructor asks for more than `capacity` elements.
+
+    // Multiplies the capacity by Numerator/Denominator, starting at Initial
+    template<std::size_t Numerator, std::size_t Denominator = 1, std::size_t Initial = 5>
+    struct Factor_growth {
+        static_assert(Numerator > Denominator, "growth factor must be greater than 1");
+        static_assert(Denominator > 0 && Initial > 0, "growth factor and initial capacity must not be 0");
+
+        template<typename T>
+        static std::size_t next_capacity(std::size_t capacity, std::size_t required) {
+            std::size_t next = capacity ? capacity / Denominator * Numerator + capacity % Denominator * Numerator / Denominator : Initial;
+            return next < required ? required : next;
+        }
+
+        template<typename T>
+        static std::size_t reserve_capacity(std::size_t /*capacity*/, std::size_t requested) {
+            return requested;
+        }
+    };
+
+    // 2x, the default: fewest reallocations
+    using Doubling_growth = Factor_growth<2>;
+
+    // 1.5x: less slack per Vector for memory bound services
+    using Half_growth = Factor_growth<3, 2>;
+
+    // Grows by whole pages of PageBytes, so huge buffers never carry more than
+    // a page of slack. Every growth copies the buffer, prefer reserve() up front.
+    template<std::size_t PageBytes = 4096>
+    struct Page_growth {
+        static_assert(PageBytes > 0, "page size must not be 0");
+
+        template<typename T>
+        static std::size_t next_capacity(std::size_t /*capacity*/, std::size_t required) {
+            std::size_t bytes = (required * sizeof(T) + PageBytes - 1) / PageBytes * PageBytes;
+            return bytes / sizeof(T);
+        }
+
+        template<typename T>
+        static std::size_t reserve_capacity(std::size_t /*capacity*/, std::size_t requested) {
+            return requested;
+        }
+    };
+
+    // Allocates Capacity elements the first time and never reallocates after
+    // that, whether the Vector grows, is reserved or is constructed
+    template<std::size_t Capacity>
+    struct Fixed_capacity {
+        static_assert(Capacity > 0, "fixed capacity must not be 0");
+
+        template<typename T>
+        static std::size_t next_capacity(std::size_t /*capacity*/, std::size_t required) {
+            if (required > Capacity) {
+                throw std::length_error("ERROR: Fixed capacity exceeded in Vector");
+            }
+            return Capacity;
+        }
+
+        template<typename T>
+        static std::size_t reserve_capacity(std::size_t capacity, std::size_t requested) {
+            return next_capacity<T>(capacity, requested);
+        }
+    };
+
+} // namespace container
@@ -3,32 +3,49 @@
 #include <stdexcept>
 #include <initializer_list>
 #include <sstream>
+#include <memory>
+#include <functional>
+#include "Format.hpp"
+#include "Stats.hpp"
 
 namespace container {
 
-	template <typename T>
+	template <typename T, typename Allocator = std::allocator<T>>
 	class List {
-			// Node of the list
+			// Node of the list, the value is constructed separately so that the
+			// end node needs no T at all
 			struct Node{
-				Node(const T &val, Node* next_ , Node* prev_)
-					:value{val}, next{next_}, prev{prev_} {}
+				Node(Node* next_ , Node* prev_)
+					:next{next_}, prev{prev_} {}
+				~Node() {}
 
-				T value{};
 				Node *next;
 				Node *prev;
+				union {
+					T value;
+				};
 			};
 
+			// allocator rebound to the node type
+			using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+			using node_traits = std::allocator_traits<node_allocator>;
+			using recorder = stats::Recorder<List>; // operation counters, empty unless CONTAINER_STATS
+
 		public:
+			using value_type = T;
+			using allocator_type = Allocator;
 
 			// Constructors, destructor, assignment operators
 			List();
+			explicit List(const Allocator &alloc);
 			List(const List &list); //copy constructor
 			List(List && list) noexcept; // move constructor
-			List(const std::initializer_list<T> &elements); //initializer list constructor
+			List(const std::initializer_list<T> &elements, const Allocator &alloc = Allocator()); //initializer list constructor
 			virtual ~List();
 
-			List<T> &operator=(const List &list); // implements copy swap idiom
-			List<T> &operator=(List &&list) noexcept;
+			List<T, Allocator> &operator=(const List &list); // implements copy swap idiom
+			List<T, Allocator> &operator=(List &&list) noexcept;
+			allocator_type get_allocator() const;
 
 			// Element access
 			T &operator[](const std::size_t index);
@@ -52,24 +69,46 @@ namespace container {
 
 			// Modifiers
 			void clear();
+			template<class... Args>
+			iterator emplace(const_iterator it, Args&&... args);
+			template<class... Args>
+			T &emplace_front(Args&&... args);
+			template<class... Args>
+			T &emplace_back(Args&&... args);
 			iterator insert(const_iterator it, const T &value);
-			iterator insert(const_iterator it, T &&value) noexcept;
+			iterator insert(const_iterator it, T &&value);
 			void push_front(const T &value);
-			void push_front(T &&value) noexcept;
+			void push_front(T &&value);
 			void push_mid(const T &value);
-			void push_mid(T &&value) noexcept;
+			void push_mid(T &&value);
 			void push_back(const T &value);
-			void push_back(T &&value) noexcept;
+			void push_back(T &&value);
 			iterator erase(const_iterator it);
 			iterator erase(const std::size_t index);
 			void pop_front();
 			void pop_back();
-			void swap(List<T> &list) noexcept;
+			void swap(List<T, Allocator> &list) noexcept;
 
 
 			//Operations
-			void reverse();
+			void splice(const_iterator pos, List &other);
+			void splice(const_iterator pos, List &&other);
+			void splice(const_iterator pos, List &other, const_iterator it);
+			void splice(const_iterator pos, List &other, const_iterator first, const_iterator last);
+			void merge(List &other);
+			void merge(List &&other);
+			template<class Compare>
+			void merge(List &other, Compare comp);
+			void sort();
+			template<class Compare>
+			void sort(Compare comp);
+			std::size_t unique();
+			template<class BinaryPredicate>
+			std::size_t unique(BinaryPredicate pred);
+			void reverse() noexcept;
 			std::string toString(const std::string &name = "") const;
+			std::string toString(const std::string &name, const Summary &summary) const;
+			void format_to(Text_buffer &buffer, const std::string &name = "", const Summary &summary = Summary()) const;
 
 			bool operator==(const List &other) const;
 			bool operator!=(const List &other) const;
@@ -78,42 +117,66 @@ namespace container {
 			std::size_t m_size{};
 			Node *head;
 			Node *tail;
-
-			// helper
+			node_allocator m_alloc;
+			// finger: the node found by the last non-const indexed access, nullptr
+			// when unknown. const access only reads it, so concurrent readers never write.
+			Node *m_finger{};
+			std::size_t m_finger_index{};
+
+			// helpers
+			Node *walk_to(const std::size_t index) const;
 			Node *seek(const std::size_t index);
+			std::size_t index_of(const Node *node) const noexcept;
+			template<class... Args>
+			Node *create_node(Node *next, Node *prev, Args&&... args);
+			Node *create_end_node();
+			void destroy_node(Node *node) noexcept;
+			void destroy_end_node(Node *node) noexcept;
+			void free_nodes() noexcept;
+			void check_allocator(const List &other) const;
+			void unlink(Node *first, Node *last) noexcept;
+			void link_before(Node *pos, Node *first, Node *last) noexcept;
+			template<class Compare>
+			static Node *merge_chains(Node *left, Node *right, Compare &comp);
 	};
 
 //-------------- Class List Implementation --------------//
 	// Constructors, destructor assign operator //
-	template <typename T>
-	List<T>::List() :m_size{}, head{new Node{T{}, nullptr, nullptr}}, tail{head} {}
+	template <typename T, typename Allocator>
+	List<T, Allocator>::List() :List{Allocator()} {}
 
-	template <typename T>
-	List<T>::List(const List<T> &list) :List{} {
+	template <typename T, typename Allocator>
+	List<T, Allocator>::List(const Allocator &alloc) :m_size{}, head{nullptr}, tail{nullptr}, m_alloc{alloc} {
+		head = tail = create_end_node();
+	}
+
+	template <typename T, typename Allocator>
+	List<T, Allocator>::List(const List &list)
+		:List{std::allocator_traits<Allocator>::select_on_container_copy_construction(list.get_allocator())} {
 		for (const auto &it : list) {
 			push_back(it);
 		}
 	}
 
-	template <typename T>
-	List<T>::List(List &&list) noexcept :List{} {
+	template <typename T, typename Allocator>
+	List<T, Allocator>::List(List &&list) noexcept :List{list.get_allocator()} {
 		swap(list);
 	}
 
-	template <typename T>
-	List<T>::List(const std::initializer_list<T> &elements) :List{} {
+	template <typename T, typename Allocator>
+	List<T, Allocator>::List(const std::initializer_list<T> &elements, const Allocator &alloc) :List{alloc} {
 		for (auto &element: elements)	{
 			push_back(element);
 		}
 	}
 
-	template <typename T>
-	List<T>::~List(){
-		clear();
+	template <typename T, typename Allocator>
+	List<T, Allocator>::~List(){
+		free_nodes();
 	}
 
-	template<typename T>
-	List<T>& List<T>::operator=(const List<T> &list){
+	template<typename T, typename Allocator>
+	List<T, Allocator>& List<T, Allocator>::operator=(const List &list){
 		if (this != &list){
 			auto temp{list};
 			swap(temp);
@@ -121,145 +184,306 @@ namespace container {
 		return *this;
 	}
 
-	template<typename T>
-	List<T>& List<T>::operator=(List<T> &&list) noexcept {
+	template<typename T, typename Allocator>
+	List<T, Allocator>& List<T, Allocator>::operator=(List &&list) noexcept {
 		if (this != &list){
 			swap(list);
 		}
 		return *this;
 	}
 
+	template<typename T, typename Allocator>
+	typename List<T, Allocator>::allocator_type List<T, Allocator>::get_allocator() const {
+		return allocator_type(m_alloc);
+	}
+
 	//--------------- Element access ---------------//
-	template<typename T>
-	T& List<T>::operator[](const std::size_t index) {
+	template<typename T, typename Allocator>
+	T& List<T, Allocator>::operator[](const std::size_t index) {
 		return seek(index)->value;
 	}
 
-	template<typename T>
-	const T& List<T>::operator[](const std::size_t index) const {
-		return seek(index)->value;
+	template<typename T, typename Allocator>
+	const T& List<T, Allocator>::operator[](const std::size_t index) const {
+		return walk_to(index)->value;
 	}
 
-	// private member function
-	template<typename T>
-	typename List<T>::Node *List<T>::seek(const std::size_t index) {
+	// private member function, walks from whichever of head, tail and the
+	// finger is closest without moving the finger
+	template<typename T, typename Allocator>
+	typename List<T, Allocator>::Node *List<T, Allocator>::walk_to(const std::size_t index) const {
 		if (index >= m_size) {
 			throw std::out_of_range("ERROR: Index out of bounds in List");
 		}
-		Node *temp = nullptr;
-		if (index < m_size / 2) {
-			// normal way
-			temp = head;
-			for (size_t i = 0; i < index; ++i) {
-				temp = temp->next;
-			}
-		}else {
-			// reverse way
+		Node *temp = head;
+		std::size_t position = 0;
+		if (m_size - index < index) {
 			temp = tail;
-			for (size_t i = m_size; i > index; --i) {
-				temp = temp->prev;
+			position = m_size;
+		}
+		if (m_finger) {
+			std::size_t distance = index > m_finger_index ? index - m_finger_index : m_finger_index - index;
+			if (distance < (index > position ? index - position : position - index)) {
+				temp = m_finger;
+				position = m_finger_index;
 			}
 		}
+		recorder::walked(index > position ? index - position : position - index);
+		for (; position < index; ++position) {
+			temp = temp->next;
+		}
+		for (; position > index; --position) {
+			temp = temp->prev;
+		}
 		return temp;
 	}
 
+	// private member function, walk_to() that leaves the finger on the node found
+	template<typename T, typename Allocator>
+	typename List<T, Allocator>::Node *List<T, Allocator>::seek(const std::size_t index) {
+		Node *node = walk_to(index);
+		m_finger = node;
+		m_finger_index = index;
+		return node;
+	}
+
+	// private member function, the index of node when it is known without a walk,
+	// m_size + 1 otherwise
+	template<typename T, typename Allocator>
+	std::size_t List<T, Allocator>::index_of(const Node *node) const noexcept {
+		if (node == m_finger) {
+			return m_finger_index;
+		}
+		if (node == head) {
+			return 0;
+		}
+		if (node == tail) {
+			return m_size;
+		}
+		if (node == tail->prev) {
+			return m_size - 1;
+		}
+		return m_size + 1;
+	}
+
+	// private member function
+	template<typename T, typename Allocator>
+	template<class... Args>
+	typename List<T, Allocator>::Node *List<T, Allocator>::create_node(Node *next, Node *prev, Args&&... args) {
+		Node *node = create_end_node();
+		try {
+			node_traits::construct(m_alloc, std::addressof(node->value), std::forward<Args>(args)...);
+		} catch (...) {
+			destroy_end_node(node);
+			throw;
+		}
+		recorder::template constructed<T, Args...>(1);
+		node->next = next;
+		node->prev = prev;
+		return node;
+	}
+
+	// private member function
+	template<typename T, typename Allocator>
+	typename List<T, Allocator>::Node *List<T, Allocator>::create_end_node() {
+		Node *node = node_traits::allocate(m_alloc, 1);
+		recorder::allocation(sizeof(Node));
+		node_traits::construct(m_alloc, node, nullptr, nullptr);
+		return node;
+	}
+
+	// private member function
+	template<typename T, typename Allocator>
+	void List<T, Allocator>::destroy_node(Node *node) noexcept {
+		node_traits::destroy(m_alloc, std::addressof(node->value));
+		destroy_end_node(node);
+	}
+
+	// private member function
+	template<typename T, typename Allocator>
+	void List<T, Allocator>::destroy_end_node(Node *node) noexcept {
+		node_traits::destroy(m_alloc, node);
+		node_traits::deallocate(m_alloc, node, 1);
+		recorder::deallocation();
+	}
+
+	// private member function
+	template<typename T, typename Allocator>
+	void List<T, Allocator>::free_nodes() noexcept {
+		if (!head) return;
+
+		while (head->next) {
+			head = head->next;
+			destroy_node(head->prev);
+		}
+		destroy_end_node(head);
+		head = tail = m_finger = nullptr;
+		m_size = 0;
+	}
+
+	// private member function, nodes only change lists when either allocator can free them
+	template<typename T, typename Allocator>
+	void List<T, Allocator>::check_allocator(const List &other) const {
+		if (!node_traits::is_always_equal::value && !(m_alloc == other.m_alloc)) {
+			throw std::runtime_error("ERROR: Splicing between lists with unequal allocators");
+		}
+	}
+
+	// private member function, detaches the nodes [first, last) from the list
+	template<typename T, typename Allocator>
+	void List<T, Allocator>::unlink(Node *first, Node *last) noexcept {
+		if (first->prev) {
+			first->prev->next = last;
+		} else {
+			head = last;
+		}
+		last->prev = first->prev;
+	}
+
+	// private member function, links the detached chain first..last (inclusive) before pos
+	template<typename T, typename Allocator>
+	void List<T, Allocator>::link_before(Node *pos, Node *first, Node *last) noexcept {
+		first->prev = pos->prev;
+		if (pos->prev) {
+			pos->prev->next = first;
+		} else {
+			head = first;
+		}
+		last->next = pos;
+		pos->prev = last;
+	}
+
+	// private member function, stable merge of two sorted chains linked through next only
+	template<typename T, typename Allocator>
+	template<class Compare>
+	typename List<T, Allocator>::Node *List<T, Allocator>::merge_chains(Node *left, Node *right, Compare &comp) {
+		Node *merged = nullptr;
+		Node **link = &merged;
+		while (left && right) {
+			if (comp(right->value, left->value)) {
+				*link = right;
+				right = right->next;
+			} else {
+				*link = left;
+				left = left->next;
+			}
+			link = &(*link)->next;
+		}
+		*link = left ? left : right;
+		return merged;
+	}
+
 	//-----------------  Iterators -----------------//
-	template<typename T>
-	typename List<T>::iterator List<T>::begin() noexcept {
+	template<typename T, typename Allocator>
+	typename List<T, Allocator>::iterator List<T, Allocator>::begin() noexcept {
 		return iterator{head};
 	}
 
-	template<typename T>
-	typename List<T>::const_iterator List<T>::begin() const noexcept {
+	template<typename T, typename Allocator>
+	typename List<T, Allocator>::const_iterator List<T, Allocator>::begin() const noexcept {
 		return cbegin();
 	}
 
-	template<typename T>
-	typename List<T>::const_iterator List<T>::cbegin() const noexcept {
+	template<typename T, typename Allocator>
+	typename List<T, Allocator>::const_iterator List<T, Allocator>::cbegin() const noexcept {
 		return const_iterator{head};
 	}
 
-	template<typename T>
-	typename List<T>::iterator List<T>::end() noexcept {
+	template<typename T, typename Allocator>
+	typename List<T, Allocator>::iterator List<T, Allocator>::end() noexcept {
 		return iterator{tail};
 	}
 
-	template<typename T>
-	typename List<T>::const_iterator List<T>::end() const noexcept{
+	template<typename T, typename Allocator>
+	typename List<T, Allocator>::const_iterator List<T, Allocator>::end() const noexcept{
 		return cend();
 	}
 
-	template<typename T>
-	typename List<T>::const_iterator List<T>::cend() const noexcept{
+	template<typename T, typename Allocator>
+	typename List<T, Allocator>::const_iterator List<T, Allocator>::cend() const noexcept{
 		return const_iterator{tail};
 	}
 
 	//-----------------  Capacity ------------------//
-	template<typename T>
-	std::size_t List<T>::size() const {
+	template<typename T, typename Allocator>
+	std::size_t List<T, Allocator>::size() const {
 		return m_size;
 	}
 
-	template<typename T>
-	bool List<T>::empty() const{
+	template<typename T, typename Allocator>
+	bool List<T, Allocator>::empty() const{
 		return head == tail;
 	}
 
 	//-----------------  Modifiers -----------------//
-	template<typename T>
-	void List<T>::clear() {
-		if (!head) return;
-
-		while (head->next) {
-			head = head->next;
-			delete head->prev;
-		}
-		delete head;
-		head = tail = nullptr;
-		m_size = 0;
-	}
-
-	template <typename T>
-	typename List<T>::iterator List<T>::insert(const_iterator it, const T &value){
-		if (it == nullptr && m_size) {
+	template<typename T, typename Allocator>
+	void List<T, Allocator>::clear() {
+		// every node including the end node is returned before a new end node is
+		// made, so a pooled allocator can give its chunks back
+		free_nodes();
+		head = tail = create_end_node();
+	}
+
+	template <typename T, typename Allocator>
+	template <class... Args>
+	typename List<T, Allocator>::iterator List<T, Allocator>::emplace(const_iterator it, Args&&... args){
+		if (it == nullptr) {
 			throw std::runtime_error("ERROR: Empty or null Iterator");
 		}
 
 		Node *current = it.current_node;
-		Node *new_node = new Node(value, current, current->prev);
+		std::size_t index = index_of(current);
+		Node *new_node = create_node(current, current->prev, std::forward<Args>(args)...);
 		if (new_node->prev) {
 				new_node->prev->next = new_node;
+		}else{
+				head = new_node;
 		}
 		current->prev = new_node;
 		m_size++;
+		recorder::size(m_size);
 
-		return (new_node);
-	}
+		// the finger moves to the new node when its index is known
+		m_finger = index < m_size ? new_node : nullptr;
+		m_finger_index = index;
 
-	template <typename T>
-	typename List<T>::iterator List<T>::insert(const_iterator it, T &&value) noexcept {
-		Node *current = it.current_node;
-		Node *new_node = new Node(std::move(value), current, current->prev);
-		if (new_node->prev) {
-				new_node->prev->next = new_node;
-		}
-		current->prev = new_node;
-		m_size++;
 		return iterator(new_node);
 	}
 
-	template <typename T>
-	void List<T>::push_front(const T &value) {
-		head = insert (begin(), value).current_node;
+	template <typename T, typename Allocator>
+	template <class... Args>
+	T &List<T, Allocator>::emplace_front(Args&&... args){
+		return *emplace(begin(), std::forward<Args>(args)...);
+	}
+
+	template <typename T, typename Allocator>
+	template <class... Args>
+	T &List<T, Allocator>::emplace_back(Args&&... args){
+		return *emplace(end(), std::forward<Args>(args)...);
+	}
+
+	template <typename T, typename Allocator>
+	typename List<T, Allocator>::iterator List<T, Allocator>::insert(const_iterator it, const T &value){
+		return emplace(it, value);
 	}
 
-	template <typename T>
-	void List<T>::push_front(T &&value) noexcept {
-		head = insert (begin(), std::move(value)).current_node;
+	template <typename T, typename Allocator>
+	typename List<T, Allocator>::iterator List<T, Allocator>::insert(const_iterator it, T &&value) {
+		return emplace(it, std::move(value));
 	}
 
-	template <typename T>
-	void List<T>::push_mid(const T &value) {
+	template <typename T, typename Allocator>
+	void List<T, Allocator>::push_front(const T &value) {
+		emplace(begin(), value);
+	}
+
+	template <typename T, typename Allocator>
+	void List<T, Allocator>::push_front(T &&value) {
+		emplace(begin(), std::move(value));
+	}
+
+	template <typename T, typename Allocator>
+	void List<T, Allocator>::push_mid(const T &value) {
 		if(!empty()){
 			insert (const_iterator(seek(m_size/2)), value);
 		}else {
@@ -267,8 +491,8 @@ namespace container {
 		}
 	}
 
-	template <typename T>
-	void List<T>::push_mid(T &&value) noexcept {
+	template <typename T, typename Allocator>
+	void List<T, Allocator>::push_mid(T &&value) {
 		if(!empty()){
 			insert (const_iterator(seek(m_size/2)), std::move(value));
 		}else {
@@ -276,30 +500,29 @@ namespace container {
 		}
 	}
 
-	template <typename T>
-	void List<T>::push_back(const T &value) {
-		if(!empty()){
-			insert (end(), value);
-		}else {
-			push_front(value);
-		}
+	template <typename T, typename Allocator>
+	void List<T, Allocator>::push_back(const T &value) {
+		emplace(end(), value);
 	}
 
-	template <typename T>
-	void List<T>::push_back(T &&value) noexcept {
-		if(!empty()){
-			insert (end(), std::move(value));
-		}else {
-			push_front(std::move(value));
-		}
+	template <typename T, typename Allocator>
+	void List<T, Allocator>::push_back(T &&value) {
+		emplace(end(), std::move(value));
 	}
 
-	template <typename T>
-	typename List<T>::iterator List<T>::erase(const_iterator it) {
+	template <typename T, typename Allocator>
+	typename List<T, Allocator>::iterator List<T, Allocator>::erase(const_iterator it) {
 		Node *current = it.current_node;
-		iterator to_return{current};
-		if (!head || !current){
-			return to_return;
+		if (!head || !current || current == tail){
+			return iterator{current};
+		}
+		iterator to_return{current->next};
+		std::size_t index = index_of(current);
+		if (m_finger == current || index > m_size) {
+			// the finger keeps its index on the next node, or is lost with an unknown index
+			m_finger = index < m_size - 1 ? current->next : nullptr;
+		} else if (m_finger && index < m_finger_index) {
+			--m_finger_index;
 		}
 		if (current->prev){
 			current->prev->next = current->next;
@@ -313,97 +536,289 @@ namespace container {
 			tail = current->prev;
 		}
 
-		delete current;
+		destroy_node(current);
 		--m_size;
 		return to_return;
 	}
 
-	template <typename T>
-	typename List<T>::iterator List<T>::erase(const std::size_t index) {
+	template <typename T, typename Allocator>
+	typename List<T, Allocator>::iterator List<T, Allocator>::erase(const std::size_t index) {
 		return erase(const_iterator(seek(index)));
 	}
 
-	template <typename T>
-	void List<T>::pop_front() {
+	template <typename T, typename Allocator>
+	void List<T, Allocator>::pop_front() {
 		if (empty()) {
 			throw std::runtime_error("ERROR: Empty container");
 		}
 		erase(begin());
 	}
 
-	template <typename T>
-	void List<T>::pop_back() {
+	template <typename T, typename Allocator>
+	void List<T, Allocator>::pop_back() {
 		if (empty()) {
 			throw std::runtime_error("ERROR: Empty container");
 		}
-		erase(end());
+		erase(const_iterator{tail->prev});
 	}
 
-	template <typename T>
-	void List<T>::swap(List<T> &list) noexcept {
+	template <typename T, typename Allocator>
+	void List<T, Allocator>::swap(List<T, Allocator> &list) noexcept {
 		std::swap(head, list.head);
 		std::swap(tail, list.tail);
 		std::swap(m_size, list.m_size);
+		std::swap(m_finger, list.m_finger);
+		std::swap(m_finger_index, list.m_finger_index);
+		if constexpr (node_traits::propagate_on_container_swap::value){
+			std::swap(m_alloc, list.m_alloc);
+		}
 	}
 
 	//-----------------  Operations -----------------//
-	template<typename T>
-	void List<T>::reverse(){
-		List<T> temp_list;
+	template<typename T, typename Allocator>
+	void List<T, Allocator>::splice(const_iterator pos, List &other) {
+		if (pos == nullptr) {
+			throw std::runtime_error("ERROR: Empty or null Iterator");
+		}
+		if (this == &other || other.empty()) {
+			return;
+		}
+		check_allocator(other);
+
+		Node *first = other.head;
+		Node *last = other.tail->prev;
+		other.unlink(first, other.tail);
+		link_before(pos.current_node, first, last);
+		m_size += other.m_size;
+		other.m_size = 0;
+		recorder::size(m_size);
+		m_finger = other.m_finger = nullptr;
+	}
 
-		for (const auto &it : *this){
-			temp_list.push_front(it);
+	template<typename T, typename Allocator>
+	void List<T, Allocator>::splice(const_iterator pos, List &&other) {
+		splice(pos, other);
+	}
+
+	template<typename T, typename Allocator>
+	void List<T, Allocator>::splice(const_iterator pos, List &other, const_iterator it) {
+		if (pos == nullptr || it == nullptr) {
+			throw std::runtime_error("ERROR: Empty or null Iterator");
+		}
+		Node *node = it.current_node;
+		if (node == other.tail || node == pos.current_node || node->next == pos.current_node) {
+			return;
+		}
+		check_allocator(other);
+
+		other.unlink(node, node->next);
+		link_before(pos.current_node, node, node);
+		++m_size;
+		--other.m_size;
+		recorder::size(m_size);
+		m_finger = other.m_finger = nullptr;
+	}
+
+	// moving a range out of another list counts its nodes, within one list it is O(1)
+	template<typename T, typename Allocator>
+	void List<T, Allocator>::splice(const_iterator pos, List &other, const_iterator first, const_iterator last) {
+		if (pos == nullptr || first == nullptr || last == nullptr) {
+			throw std::runtime_error("ERROR: Empty or null Iterator");
 		}
+		if (first == last) {
+			return;
+		}
+		check_allocator(other);
+
+		std::size_t count = 0;
+		Node *back = last.current_node->prev;
+		if (this != &other) {
+			for (Node *node = first.current_node; node != last.current_node; node = node->next) {
+				++count;
+			}
+		}
+		other.unlink(first.current_node, last.current_node);
+		link_before(pos.current_node, first.current_node, back);
+		m_size += count;
+		other.m_size -= count;
+		recorder::size(m_size);
+		m_finger = other.m_finger = nullptr;
+	}
 
-		*this = temp_list;
+	template<typename T, typename Allocator>
+	void List<T, Allocator>::merge(List &other) {
+		merge(other, std::less<>{});
 	}
 
-	template<typename T>
-	std::string List<T>::toString(const std::string & name) const {
-		std::stringstream stream;
-		stream << "\n<===== List: " << name << " ======>\n >>Size:" << m_size;
-		std::size_t index = 0;
-		for (const auto &it : *this) {
-			stream << "\n [" << index << "]=> " << it ;
-			index++;
+	template<typename T, typename Allocator>
+	void List<T, Allocator>::merge(List &&other) {
+		merge(other, std::less<>{});
+	}
+
+	// both lists must be sorted by comp; equal elements of *this stay in front
+	template<typename T, typename Allocator>
+	template<class Compare>
+	void List<T, Allocator>::merge(List &other, Compare comp) {
+		if (this == &other || other.empty()) {
+			return;
+		}
+		check_allocator(other);
+
+		m_finger = other.m_finger = nullptr;
+		Node *current = head;
+		while (current != tail && !other.empty()) {
+			Node *node = other.head;
+			if (comp(node->value, current->value)) {
+				other.unlink(node, node->next);
+				link_before(current, node, node);
+				++m_size;
+				--other.m_size;
+			} else {
+				current = current->next;
+			}
 		}
-		stream << "\n<=== End " << name << " ====>\n";
-		return stream.str();
+		splice(const_iterator{tail}, other);
 	}
 
-	template<typename T>
-    bool List<T>::operator==(const List& other) const{
+	template<typename T, typename Allocator>
+	void List<T, Allocator>::sort() {
+		sort(std::less<>{});
+	}
+
+	// stable bottom-up merge sort: nodes are relinked, no element is copied
+	// and nothing is allocated. bins[i] holds a sorted run of 2^i nodes.
+	template<typename T, typename Allocator>
+	template<class Compare>
+	void List<T, Allocator>::sort(Compare comp) {
+		if (m_size < 2) {
+			return;
+		}
+
+		m_finger = nullptr;
+		Node *bins[64] = {};
+		tail->prev->next = nullptr;
+		for (Node *node = head; node;) {
+			Node *carry = node;
+			node = node->next;
+			carry->next = nullptr;
+
+			std::size_t i = 0;
+			for (; bins[i]; ++i) {
+				carry = merge_chains(bins[i], carry, comp); // older run on the left keeps it stable
+				bins[i] = nullptr;
+			}
+			bins[i] = carry;
+		}
+
+		Node *sorted = nullptr;
+		for (auto bin : bins) {
+			if (bin) {
+				sorted = sorted ? merge_chains(bin, sorted, comp) : bin;
+			}
+		}
+
+		// restore the prev links and the end node
+		head = sorted;
+		Node *prev = nullptr;
+		for (Node *node = sorted; node; node = node->next) {
+			node->prev = prev;
+			prev = node;
+		}
+		prev->next = tail;
+		tail->prev = prev;
+	}
+
+	template<typename T, typename Allocator>
+	std::size_t List<T, Allocator>::unique() {
+		return unique(std::equal_to<>{});
+	}
+
+	// removes every element equal to the one before it
+	template<typename T, typename Allocator>
+	template<class BinaryPredicate>
+	std::size_t List<T, Allocator>::unique(BinaryPredicate pred) {
+		std::size_t removed = 0;
+		if (empty()) {
+			return removed;
+		}
+		for (Node *node = head->next; node != tail;) {
+			if (pred(node->prev->value, node->value)) {
+				node = erase(const_iterator{node}).current_node;
+				++removed;
+			} else {
+				node = node->next;
+			}
+		}
+		return removed;
+	}
+
+	// relinks the nodes in the opposite order, no element is moved
+	template<typename T, typename Allocator>
+	void List<T, Allocator>::reverse() noexcept {
+		if (m_size < 2) {
+			return;
+		}
+		Node *first = head;
+		Node *last = tail->prev;
+		for (Node *node = head; node != tail;) {
+			Node *next = node->next;
+			std::swap(node->next, node->prev);
+			node = next;
+		}
+		head = last;
+		head->prev = nullptr;
+		first->next = tail;
+		tail->prev = first;
+		m_finger_index = m_size - 1 - m_finger_index;
+	}
+
+	template<typename T, typename Allocator>
+	std::string List<T, Allocator>::toString(const std::string & name) const {
+		return toString(name, Summary());
+	}
+
+	template<typename T, typename Allocator>
+	std::string List<T, Allocator>::toString(const std::string &name, const Summary &summary) const {
+		Text_buffer buffer(table_capacity(name, m_size, summary));
+		format_to(buffer, name, summary);
+		return buffer.take();
+	}
+
+	// appends the toString text to buffer, which can be reused across dumps
+	template<typename T, typename Allocator>
+	void List<T, Allocator>::format_to(Text_buffer &buffer, const std::string &name, const Summary &summary) const {
+		format_table(buffer, "List", name, cbegin(), m_size, summary);
+	}
+
+	template<typename T, typename Allocator>
+    bool List<T, Allocator>::operator==(const List& other) const{
+		if (m_size != other.m_size) {
+			return false;
+		}
+		// the end node holds no value, so only the elements are compared
 		auto itOther = other.cbegin();
-		auto it = cbegin();
-		
-		for (; it != cend() || itOther != other.cend(); ++it, ++itOther) {
+		for (auto it = cbegin(); it != cend(); ++it, ++itOther) {
 			if(*it != *itOther){
 				return false;
 			}
 		}
-
-		return *it == *itOther;
+		return true;
     }
 
-    template<typename T>
-    bool List<T>::operator!=(const List& other) const{
+    template<typename T, typename Allocator>
+    bool List<T, Allocator>::operator!=(const List& other) const{
         return !(operator==(other));
     }
 
 	//---------------- Non-member functions ----------------//
-	template<typename T>
-	std::ostream& operator<<(std::ostream& os, const List<T> & list) {
-		for (const auto &it : list) {
-			os << it << "->";
-		}
-		os << "NULL";
-
-		return os;
+	template<typename T, typename Allocator>
+	std::ostream& operator<<(std::ostream& os, const List<T, Allocator> & list) {
+		return format_inline(os, list.cbegin(), list.size(), "->", "NULL");
 	}
 
 	//-------------- Inner class const_iterator --------//
-	template <typename T>
-	class List<T>::const_iterator {
+	template <typename T, typename Allocator>
+	class List<T, Allocator>::const_iterator {
 	public:
 		const_iterator();
 
@@ -420,12 +835,12 @@ namespace container {
 
 		const_iterator(Node *new_ptr); // constructor
 		T &get() const; // get the value at the iterator current position
-		friend class List<T>;
+		friend class List<T, Allocator>;
 	};
 
 	//-------------- Inner class iterator --------//
-	template <typename T>
-	class List<T>::iterator final: public const_iterator {
+	template <typename T, typename Allocator>
+	class List<T, Allocator>::iterator final: public const_iterator {
 	public:
 		iterator();
 
@@ -439,101 +854,101 @@ namespace container {
 
 	private:
 		iterator(Node *new_ptr); // constructor
-		friend class List<T>;
+		friend class List<T, Allocator>;
 	};
 
 	//-------------- class const_iterator implementation--------//
-	template <typename T>
-	List<T>::const_iterator::const_iterator() :current_node{nullptr} {}
+	template <typename T, typename Allocator>
+	List<T, Allocator>::const_iterator::const_iterator() :current_node{nullptr} {}
 
 	//protected constructor
-	template <typename T>
-	List<T>::const_iterator::const_iterator (Node *new_ptr) :current_node{new_ptr} {}
+	template <typename T, typename Allocator>
+	List<T, Allocator>::const_iterator::const_iterator (Node *new_ptr) :current_node{new_ptr} {}
 
-	template <typename T>
-	const T &List<T>::const_iterator::operator*() const{
+	template <typename T, typename Allocator>
+	const T &List<T, Allocator>::const_iterator::operator*() const{
 		return get();
 	}
 
-	template <typename T>
-	T &List<T>::const_iterator::get() const{
+	template <typename T, typename Allocator>
+	T &List<T, Allocator>::const_iterator::get() const{
 		return current_node->value;
 	}
 
-	template <typename T>
-	typename List<T>::const_iterator &List<T>::const_iterator::operator++(){ // Prefix
+	template <typename T, typename Allocator>
+	typename List<T, Allocator>::const_iterator &List<T, Allocator>::const_iterator::operator++(){ // Prefix
 		current_node = current_node -> next;
 		return *this;
 	}
 
-	template <typename T>
-	typename List<T>::const_iterator List<T>::const_iterator::operator++(int){ // Postfix
+	template <typename T, typename Allocator>
+	typename List<T, Allocator>::const_iterator List<T, Allocator>::const_iterator::operator++(int){ // Postfix
 		const_iterator temp = *this;
 		++(*this);
 		return temp;
 	}
 
-	template <typename T>
-	typename List<T>::const_iterator &List<T>::const_iterator::operator--(){ // Prefix
+	template <typename T, typename Allocator>
+	typename List<T, Allocator>::const_iterator &List<T, Allocator>::const_iterator::operator--(){ // Prefix
 		current_node = current_node->prev;
 		return *this;
 	}
 
-	template <typename T>
-	typename List<T>::const_iterator List<T>::const_iterator::operator--(int){ // Postfix
+	template <typename T, typename Allocator>
+	typename List<T, Allocator>::const_iterator List<T, Allocator>::const_iterator::operator--(int){ // Postfix
 		const_iterator temp = *this;
 		--(*this);
 		return temp;
 	}
 
-	template <typename T>
-	bool List<T>::const_iterator::operator==(const const_iterator &other) const {
+	template <typename T, typename Allocator>
+	bool List<T, Allocator>::const_iterator::operator==(const const_iterator &other) const {
 		return current_node == other.current_node;
 	}
 
-	template <typename T>
-	bool List<T>::const_iterator::operator!=(const const_iterator &other) const {
+	template <typename T, typename Allocator>
+	bool List<T, Allocator>::const_iterator::operator!=(const const_iterator &other) const {
 		return !(*this == other);
 	}
 
 	//-------------- Class iterator implementation --------//
-	template <typename T>
-	List<T>::iterator::iterator() :const_iterator{} {}
+	template <typename T, typename Allocator>
+	List<T, Allocator>::iterator::iterator() :const_iterator{} {}
 
-	template <typename T>
-	List<T>::iterator::iterator(Node *new_ptr)  :const_iterator {new_ptr} {}
+	template <typename T, typename Allocator>
+	List<T, Allocator>::iterator::iterator(Node *new_ptr)  :const_iterator {new_ptr} {}
 
-	template <typename T>
-	const T &List<T>::iterator::operator*() const {
+	template <typename T, typename Allocator>
+	const T &List<T, Allocator>::iterator::operator*() const {
 		return const_iterator::operator*();
 	}
 
-	template <typename T>
-	T &List<T>::iterator::operator*() {
+	template <typename T, typename Allocator>
+	T &List<T, Allocator>::iterator::operator*() {
 		return const_iterator::get();
 	}
 
-	template <typename T>
-	typename List<T>::iterator &List<T>::iterator::operator++(){
+	template <typename T, typename Allocator>
+	typename List<T, Allocator>::iterator &List<T, Allocator>::iterator::operator++(){
 		this->current_node = this->current_node->next;
 		return *this;
 	}
 
-	template <typename T>
-	typename List<T>::iterator List<T>::iterator::operator++(int){
+	template <typename T, typename Allocator>
+	typename List<T, Allocator>::iterator List<T, Allocator>::iterator::operator++(int){
 		iterator temp = *this;
 		++(*this);
 		return temp;
 	}
 
-	template <typename T>
-	typename List<T>::iterator &List<T>::iterator::operator--(){
+	template <typename T, typename Allocator>
+	typename List<T, Allocator>::iterator &List<T, Allocator>::iterator::operator--(){
 		this->current_node = this->current_node->prev;
 		return *this;
 	}
 
-	template <typename T>
-	typename List<T>::iterator List<T>::iterator::operator--(int){
+	template <typename T, typename Allocator>
+	typename List<T, Allocator>::iterator List<T, Allocator>::iterator::operator--(int){
 		iterator temp = *this;
 		--(*this);
 		return temp;
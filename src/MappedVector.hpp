@@ -0,0 +1,488 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "Growth_policy.hpp"
+
+namespace container {
+
+    // Vector whose elements live in a file mapped into memory (POSIX). Opening
+    // an existing file maps it without reading it, so the elements are there
+    // at once and pages are loaded as they are touched. The file holds a small
+    // header (format, element size, element count) followed by the elements,
+    // so it must be opened again with the same T on a machine of the same
+    // byte order. Writes reach the file when the kernel writes the pages back;
+    // flush() forces them out.
+    template<typename T, typename Growth = Doubling_growth>
+    class MappedVector {
+        static_assert(std::is_trivially_copyable<T>::value, "MappedVector stores trivially copyable types only");
+        static_assert(alignof(T) <= 64, "MappedVector elements start 64 bytes into the file");
+
+    public:
+        using value_type = T;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        // Constructors and destructor
+        explicit MappedVector(const std::string &path); // opens the file, creating it when missing
+        MappedVector(const MappedVector &other) = delete; // one mapping per file
+        MappedVector &operator=(const MappedVector &other) = delete;
+        MappedVector(MappedVector &&other) noexcept;
+        MappedVector &operator=(MappedVector &&other) noexcept;
+        virtual ~MappedVector();
+
+        // Element access
+        T &at(std::size_t index);
+        const T &at(std::size_t index) const;
+        T &operator[](std::size_t index);
+        const T &operator[](std::size_t index) const;
+        T *data() noexcept;
+        const T *data() const noexcept;
+
+        // Iterators
+        iterator begin() noexcept;
+        const_iterator begin() const noexcept;
+        const_iterator cbegin() const noexcept;
+        iterator end() noexcept;
+        const_iterator end() const noexcept;
+        const_iterator cend() const noexcept;
+
+        // Capacity
+        bool empty() const noexcept;
+        void reserve(std::size_t new_cap);
+        std::size_t size() const noexcept;
+        std::size_t capacity() const noexcept;
+
+        // Modifiers
+        template<class... Args>
+        T &emplace_back(Args&&... args);
+        void push_back(const T &value);
+        iterator insert(const_iterator pos, const T &value);
+        iterator insert(std::size_t pos, const T &value);
+        iterator erase(const_iterator pos);
+        iterator erase(std::size_t pos);
+        void pop_back();
+        void clear() noexcept;
+        void swap(MappedVector &other) noexcept;
+
+        // Persistence
+        void flush(); // writes the dirty pages to the file and waits for them
+        const std::string &path() const noexcept;
+
+        //Operations
+        std::string toString(const std::string &name = "") const;
+        bool operator==(const MappedVector &other) const;
+        bool operator!=(const MappedVector &other) const;
+
+    private:
+        // First 64 bytes of the file
+        struct Header {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t element_size;
+            std::uint64_t size;
+            char reserved[40];
+        };
+        static_assert(sizeof(Header) == 64, "the elements start right after the header");
+
+        static constexpr char file_magic[8] = {'C', 'N', 'T', 'R', 'M', 'V', 'E', 'C'};
+        static constexpr std::uint32_t file_version = 1;
+
+        T *elements() const noexcept;
+        void map(std::size_t bytes);
+        void remap(std::size_t bytes);
+        void release() noexcept;
+        static std::size_t page_size();
+        [[noreturn]] void fail(const std::string &what, int error) const;
+
+    private: // members
+        std::string m_path;
+        int m_fd;
+        void *m_map;
+        std::size_t m_bytes; // length of the mapping and of the file
+        Header *m_header;
+    };
+
+//-------------- Class MappedVector Implementation ------------//
+    //------ Constructors, destructor ----------//
+    template<typename T, typename Growth>
+    MappedVector<T, Growth>::MappedVector(const std::string &path)
+        :m_path{path}, m_fd{-1}, m_map{nullptr}, m_bytes{0}, m_header{nullptr} {
+        m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (m_fd < 0){
+            fail("cannot open", errno);
+        }
+        try {
+            struct stat status;
+            if (::fstat(m_fd, &status) != 0){
+                fail("cannot stat", errno);
+            }
+            const auto file_bytes = static_cast<std::size_t>(status.st_size);
+            if (file_bytes == 0){
+                // new file: one page holding the header and the first elements
+                if (::ftruncate(m_fd, static_cast<off_t>(page_size())) != 0){
+                    fail("cannot size", errno);
+                }
+                map(page_size());
+                std::memcpy(m_header->magic, file_magic, sizeof(file_magic));
+                m_header->version = file_version;
+                m_header->element_size = sizeof(T);
+                m_header->size = 0;
+            } else {
+                if (file_bytes < sizeof(Header)){
+                    fail("not a MappedVector file", 0);
+                }
+                map(file_bytes);
+                if (std::memcmp(m_header->magic, file_magic, sizeof(file_magic)) != 0 || m_header->version != file_version){
+                    fail("not a MappedVector file", 0);
+                }
+                if (m_header->element_size != sizeof(T) || m_header->size > capacity()){
+                    fail("element size or count does not match", 0);
+                }
+            }
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    template<typename T, typename Growth>
+    MappedVector<T, Growth>::MappedVector(MappedVector &&other) noexcept
+        :m_path{}, m_fd{-1}, m_map{nullptr}, m_bytes{0}, m_header{nullptr} {
+        swap(other);
+    }
+
+    template<typename T, typename Growth>
+    MappedVector<T, Growth> &MappedVector<T, Growth>::operator=(MappedVector &&other) noexcept {
+        if (this != &other){
+            release();
+            m_path.clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    // unmapping keeps the written pages, they reach the file without flush()
+    template<typename T, typename Growth>
+    MappedVector<T, Growth>::~MappedVector(){
+        release();
+    }
+
+    //--------------- Element access ---------------//
+    template<typename T, typename Growth>
+    T &MappedVector<T, Growth>::at(std::size_t index){
+        if (index >= size()){
+            throw std::out_of_range("ERROR: Index out of bounds in MappedVector");
+        }
+        return elements()[index];
+    }
+
+    template<typename T, typename Growth>
+    const T &MappedVector<T, Growth>::at(std::size_t index) const {
+        if (index >= size()){
+            throw std::out_of_range("ERROR: Index out of bounds in MappedVector");
+        }
+        return elements()[index];
+    }
+
+    template<typename T, typename Growth>
+    T &MappedVector<T, Growth>::operator[](std::size_t index){
+        return elements()[index];
+    }
+
+    template<typename T, typename Growth>
+    const T &MappedVector<T, Growth>::operator[](std::size_t index) const {
+        return elements()[index];
+    }
+
+    template<typename T, typename Growth>
+    T *MappedVector<T, Growth>::data() noexcept {
+        return elements();
+    }
+
+    template<typename T, typename Growth>
+    const T *MappedVector<T, Growth>::data() const noexcept {
+        return elements();
+    }
+
+    //-----------------  Iterators -----------------//
+    template<typename T, typename Growth>
+    typename MappedVector<T, Growth>::iterator MappedVector<T, Growth>::begin() noexcept {
+        return elements();
+    }
+
+    template<typename T, typename Growth>
+    typename MappedVector<T, Growth>::const_iterator MappedVector<T, Growth>::begin() const noexcept {
+        return cbegin();
+    }
+
+    template<typename T, typename Growth>
+    typename MappedVector<T, Growth>::const_iterator MappedVector<T, Growth>::cbegin() const noexcept {
+        return elements();
+    }
+
+    template<typename T, typename Growth>
+    typename MappedVector<T, Growth>::iterator MappedVector<T, Growth>::end() noexcept {
+        return elements() + size();
+    }
+
+    template<typename T, typename Growth>
+    typename MappedVector<T, Growth>::const_iterator MappedVector<T, Growth>::end() const noexcept {
+        return cend();
+    }
+
+    template<typename T, typename Growth>
+    typename MappedVector<T, Growth>::const_iterator MappedVector<T, Growth>::cend() const noexcept {
+        return elements() + size();
+    }
+
+    //----------------- Capacity ------------------//
+    template<typename T, typename Growth>
+    bool MappedVector<T, Growth>::empty() const noexcept {
+        return size() == 0;
+    }
+
+    // grows the file to whole pages and maps it again, possibly elsewhere:
+    // pointers and iterators to the elements are invalidated
+    template<typename T, typename Growth>
+    void MappedVector<T, Growth>::reserve(std::size_t new_cap){
+        if (new_cap <= capacity()){
+            return;
+        }
+        // the file size has to fit both std::size_t and off_t
+        const std::size_t page = page_size();
+        const std::size_t max_bytes = static_cast<std::uintmax_t>(std::numeric_limits<off_t>::max()) < std::numeric_limits<std::size_t>::max()
+            ? static_cast<std::size_t>(std::numeric_limits<off_t>::max()) : std::numeric_limits<std::size_t>::max();
+        if (new_cap > (max_bytes - sizeof(Header) - (page - 1)) / sizeof(T)){
+            throw std::length_error("ERROR: MappedVector capacity exceeds the largest file size");
+        }
+        const std::size_t bytes = (sizeof(Header) + new_cap * sizeof(T) + page - 1) / page * page;
+        if (::ftruncate(m_fd, static_cast<off_t>(bytes)) != 0){
+            fail("cannot grow", errno);
+        }
+        remap(bytes);
+    }
+
+    template<typename T, typename Growth>
+    std::size_t MappedVector<T, Growth>::size() const noexcept {
+        return m_header ? static_cast<std::size_t>(m_header->size) : 0;
+    }
+
+    template<typename T, typename Growth>
+    std::size_t MappedVector<T, Growth>::capacity() const noexcept {
+        return m_bytes > sizeof(Header) ? (m_bytes - sizeof(Header)) / sizeof(T) : 0;
+    }
+
+    //----------------- Modifiers -----------------//
+    // the element is built before growing, args may refer to the elements
+    template<typename T, typename Growth>
+    template<class... Args>
+    T &MappedVector<T, Growth>::emplace_back(Args&&... args){
+        T value(std::forward<Args>(args)...);
+        if (size() == capacity()){
+            reserve(Growth::template next_capacity<T>(capacity(), size() + 1));
+        }
+        T *slot = elements() + size();
+        std::memcpy(static_cast<void *>(slot), &value, sizeof(T));
+        ++m_header->size;
+        return *slot;
+    }
+
+    template<typename T, typename Growth>
+    void MappedVector<T, Growth>::push_back(const T &value){
+        emplace_back(value);
+    }
+
+    template<typename T, typename Growth>
+    typename MappedVector<T, Growth>::iterator MappedVector<T, Growth>::insert(const_iterator pos, const T &value){
+        return insert(static_cast<std::size_t>(pos - cbegin()), value);
+    }
+
+    template<typename T, typename Growth>
+    typename MappedVector<T, Growth>::iterator MappedVector<T, Growth>::insert(std::size_t pos, const T &value){
+        if (pos > size()){
+            throw std::out_of_range("ERROR: Index out of bounds in MappedVector");
+        }
+        const T copy = value;
+        if (size() == capacity()){
+            reserve(Growth::template next_capacity<T>(capacity(), size() + 1));
+        }
+        T *data = elements();
+        std::memmove(static_cast<void *>(data + pos + 1), data + pos, (size() - pos) * sizeof(T));
+        std::memcpy(static_cast<void *>(data + pos), &copy, sizeof(T));
+        ++m_header->size;
+        return data + pos;
+    }
+
+    template<typename T, typename Growth>
+    typename MappedVector<T, Growth>::iterator MappedVector<T, Growth>::erase(const_iterator pos){
+        return erase(static_cast<std::size_t>(pos - cbegin()));
+    }
+
+    template<typename T, typename Growth>
+    typename MappedVector<T, Growth>::iterator MappedVector<T, Growth>::erase(std::size_t pos){
+        if (pos >= size()){
+            throw std::out_of_range("ERROR: Index out of bounds in MappedVector");
+        }
+        T *data = elements();
+        std::memmove(static_cast<void *>(data + pos), data + pos + 1, (size() - pos - 1) * sizeof(T));
+        --m_header->size;
+        return data + pos;
+    }
+
+    template<typename T, typename Growth>
+    void MappedVector<T, Growth>::pop_back(){
+        if (empty()){
+            throw std::out_of_range("ERROR: pop_back on an empty MappedVector");
+        }
+        --m_header->size;
+    }
+
+    // keeps the file at its size, capacity() is unchanged
+    template<typename T, typename Growth>
+    void MappedVector<T, Growth>::clear() noexcept {
+        if (m_header){
+            m_header->size = 0;
+        }
+    }
+
+    template<typename T, typename Growth>
+    void MappedVector<T, Growth>::swap(MappedVector &other) noexcept {
+        std::swap(m_path, other.m_path);
+        std::swap(m_fd, other.m_fd);
+        std::swap(m_map, other.m_map);
+        std::swap(m_bytes, other.m_bytes);
+        std::swap(m_header, other.m_header);
+    }
+
+    //----------------- Persistence -----------------//
+    template<typename T, typename Growth>
+    void MappedVector<T, Growth>::flush(){
+        if (m_map && ::msync(m_map, m_bytes, MS_SYNC) != 0){
+            fail("cannot flush", errno);
+        }
+    }
+
+    template<typename T, typename Growth>
+    const std::string &MappedVector<T, Growth>::path() const noexcept {
+        return m_path;
+    }
+
+    //------------------- Operations -----------------------//
+    template<typename T, typename Growth>
+    std::string MappedVector<T, Growth>::toString(const std::string &name) const {
+        std::stringstream stream;
+        stream << "\n<===== MappedVector: " << name << " ======>\n >>Size:" << size();
+        std::size_t index = 0;
+        for (const auto &it : *this) {
+            stream << "\n [" << index << "]=> " << it ;
+            index++;
+        }
+        stream << "\n<=== End " << name << " ====>\n";
+        return stream.str();
+    }
+
+    template<typename T, typename Growth>
+    bool MappedVector<T, Growth>::operator==(const MappedVector &other) const {
+        return size() == other.size() && std::equal(cbegin(), cend(), other.cbegin());
+    }
+
+    template<typename T, typename Growth>
+    bool MappedVector<T, Growth>::operator!=(const MappedVector &other) const {
+        return !(operator==(other));
+    }
+
+    //---------------- Private member functions ----------------//
+    // private member function
+    template<typename T, typename Growth>
+    T *MappedVector<T, Growth>::elements() const noexcept {
+        return m_map ? reinterpret_cast<T *>(static_cast<char *>(m_map) + sizeof(Header)) : nullptr;
+    }
+
+    // private member function, maps the first bytes of the file
+    template<typename T, typename Growth>
+    void MappedVector<T, Growth>::map(std::size_t bytes){
+        void *address = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+        if (address == MAP_FAILED){
+            fail("cannot map", errno);
+        }
+        m_map = address;
+        m_bytes = bytes;
+        m_header = static_cast<Header *>(address);
+    }
+
+    // private member function, Linux moves the pages with mremap, other
+    // systems map the file again
+    template<typename T, typename Growth>
+    void MappedVector<T, Growth>::remap(std::size_t bytes){
+#if defined(__linux__)
+        void *address = ::mremap(m_map, m_bytes, bytes, MREMAP_MAYMOVE);
+        if (address == MAP_FAILED){
+            fail("cannot remap", errno);
+        }
+        m_map = address;
+        m_bytes = bytes;
+        m_header = static_cast<Header *>(address);
+#else
+        void *old = m_map;
+        const std::size_t old_bytes = m_bytes;
+        map(bytes);
+        ::munmap(old, old_bytes);
+#endif
+    }
+
+    // private member function
+    template<typename T, typename Growth>
+    void MappedVector<T, Growth>::release() noexcept {
+        if (m_map){
+            ::munmap(m_map, m_bytes);
+            m_map = nullptr;
+            m_header = nullptr;
+            m_bytes = 0;
+        }
+        if (m_fd >= 0){
+            ::close(m_fd);
+            m_fd = -1;
+        }
+    }
+
+    // private member function
+    template<typename T, typename Growth>
+    std::size_t MappedVector<T, Growth>::page_size() {
+        static const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        return page;
+    }
+
+    // private member function, throws with the path and the message of error, an errno value or 0
+    template<typename T, typename Growth>
+    void MappedVector<T, Growth>::fail(const std::string &what, int error) const {
+        std::string message = "ERROR: MappedVector " + what + " " + m_path;
+        if (error != 0){
+            message += ": " + std::string(std::strerror(error));
+        }
+        throw std::runtime_error(message);
+    }
+
+    //---------------- Non-member functions ----------------//
+    template<typename T, typename Growth>
+    std::ostream& operator<<(std::ostream& os, const MappedVector<T, Growth> &vector) {
+        for (const auto &it : vector) {
+            os << it << ", ";
+        }
+        os << "END";
+        return os;
+    }
+
+} // namespace container
@@ -0,0 +1,266 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace container {
+
+	// Slab pool for fixed-size blocks such as list nodes.
+	// Blocks are carved out of large chunks, erased blocks are recycled through
+	// a free list and the chunks of a block size are released as a whole once
+	// every block of that size has been returned (e.g. after clear()).
+	// release() drops every chunk at once and must only be used when no block
+	// is in use any more. A pool is not thread safe.
+	class Node_pool {
+		public:
+			explicit Node_pool(std::size_t max_blocks_per_chunk = 256);
+			~Node_pool();
+			Node_pool(const Node_pool &) = delete;
+			Node_pool &operator=(const Node_pool &) = delete;
+
+			void *allocate(std::size_t bytes);
+			void deallocate(void *block, std::size_t bytes) noexcept;
+			void release() noexcept;
+
+			std::size_t chunk_count() const noexcept;
+			std::size_t live_blocks() const noexcept;
+
+		private:
+			struct Free_block {
+				Free_block *next;
+			};
+
+			struct Chunk {
+				Chunk *next;
+			};
+
+			struct Size_class {
+				std::size_t block_size;
+				std::size_t live;
+				std::size_t next_chunk_blocks;
+				Free_block *free_list;
+				Chunk *chunks;
+				char *cursor;
+				char *limit;
+			};
+
+			static constexpr std::size_t alignment = alignof(std::max_align_t);
+			static constexpr std::size_t header_size = (sizeof(Chunk) + alignment - 1) / alignment * alignment;
+			static constexpr std::size_t first_chunk_blocks = 8;
+
+			std::vector<Size_class> m_classes;
+			std::size_t m_max_blocks_per_chunk;
+
+			// helpers
+			static std::size_t block_size_for(std::size_t bytes) noexcept;
+			Size_class &size_class(std::size_t block_size);
+			void add_chunk(Size_class &cls);
+			static void release(Size_class &cls) noexcept;
+	};
+
+	// Allocator handing single objects out of a shared Node_pool.
+	// Copies and rebinds share the pool, a container copy gets a fresh pool,
+	// so every container owns its pool unless one is passed in explicitly.
+	// Array and over-aligned allocations are forwarded to operator new.
+	template<typename T>
+	class Pool_allocator {
+		public:
+			using value_type = T;
+			using propagate_on_container_copy_assignment = std::true_type;
+			using propagate_on_container_move_assignment = std::true_type;
+			using propagate_on_container_swap = std::true_type;
+			using is_always_equal = std::false_type;
+
+			Pool_allocator();
+			explicit Pool_allocator(std::shared_ptr<Node_pool> pool) noexcept;
+			template<typename U>
+			Pool_allocator(const Pool_allocator<U> &other) noexcept;
+
+			T *allocate(std::size_t count);
+			void deallocate(T *data, std::size_t count) noexcept;
+			Pool_allocator select_on_container_copy_construction() const;
+
+			const std::shared_ptr<Node_pool> &pool() const noexcept;
+
+			template<typename U>
+			bool operator==(const Pool_allocator<U> &other) const noexcept;
+			template<typename U>
+			bool operator!=(const Pool_allocator<U> &other) const noexcept;
+
+		private:
+			std::shared_ptr<Node_pool> m_pool;
+
+			static constexpr bool pooled(std::size_t count) noexcept;
+	};
+
+//-------------- Class Node_pool Implementation --------------//
+	inline Node_pool::Node_pool(std::size_t max_blocks_per_chunk)
+		:m_classes{}, m_max_blocks_per_chunk{max_blocks_per_chunk < first_chunk_blocks ? first_chunk_blocks : max_blocks_per_chunk} {}
+
+	inline Node_pool::~Node_pool() {
+		release();
+	}
+
+	inline void *Node_pool::allocate(std::size_t bytes) {
+		auto &cls = size_class(block_size_for(bytes));
+		void *block = nullptr;
+		if (cls.free_list) {
+			block = cls.free_list;
+			cls.free_list = cls.free_list->next;
+		} else {
+			if (cls.cursor == cls.limit) {
+				add_chunk(cls);
+			}
+			block = cls.cursor;
+			cls.cursor += cls.block_size;
+		}
+		++cls.live;
+		return block;
+	}
+
+	inline void Node_pool::deallocate(void *block, std::size_t bytes) noexcept {
+		if (!block) {
+			return;
+		}
+		const auto block_size = block_size_for(bytes);
+		for (auto &cls : m_classes) {
+			if (cls.block_size == block_size && cls.live) {
+				if (--cls.live == 0) {
+					release(cls);
+				} else {
+					cls.free_list = ::new (block) Free_block{cls.free_list};
+				}
+				return;
+			}
+		}
+	}
+
+	inline void Node_pool::release() noexcept {
+		for (auto &cls : m_classes) {
+			release(cls);
+		}
+	}
+
+	inline std::size_t Node_pool::chunk_count() const noexcept {
+		std::size_t count = 0;
+		for (const auto &cls : m_classes) {
+			for (auto chunk = cls.chunks; chunk; chunk = chunk->next) {
+				++count;
+			}
+		}
+		return count;
+	}
+
+	inline std::size_t Node_pool::live_blocks() const noexcept {
+		std::size_t count = 0;
+		for (const auto &cls : m_classes) {
+			count += cls.live;
+		}
+		return count;
+	}
+
+	// private member function
+	inline std::size_t Node_pool::block_size_for(std::size_t bytes) noexcept {
+		// an object's size is a multiple of its alignment, so blocks of equal size
+		// laid out from a max_align_t aligned chunk stay correctly aligned
+		if (bytes < sizeof(Free_block)) {
+			bytes = sizeof(Free_block);
+		}
+		return (bytes + alignof(Free_block) - 1) / alignof(Free_block) * alignof(Free_block);
+	}
+
+	// private member function
+	inline Node_pool::Size_class &Node_pool::size_class(std::size_t block_size) {
+		for (auto &cls : m_classes) {
+			if (cls.block_size == block_size) {
+				return cls;
+			}
+		}
+		m_classes.push_back(Size_class{block_size, 0, first_chunk_blocks, nullptr, nullptr, nullptr, nullptr});
+		return m_classes.back();
+	}
+
+	// private member function, chunk sizes double up to m_max_blocks_per_chunk
+	inline void Node_pool::add_chunk(Size_class &cls) {
+		const auto blocks = cls.next_chunk_blocks;
+		auto memory = static_cast<char *>(::operator new(header_size + blocks * cls.block_size));
+		cls.chunks = ::new (memory) Chunk{cls.chunks};
+		cls.cursor = memory + header_size;
+		cls.limit = cls.cursor + blocks * cls.block_size;
+		if (blocks < m_max_blocks_per_chunk) {
+			cls.next_chunk_blocks = blocks * 2 < m_max_blocks_per_chunk ? blocks * 2 : m_max_blocks_per_chunk;
+		}
+	}
+
+	// private member function
+	inline void Node_pool::release(Size_class &cls) noexcept {
+		while (cls.chunks) {
+			auto next = cls.chunks->next;
+			::operator delete(cls.chunks);
+			cls.chunks = next;
+		}
+		cls.live = 0;
+		cls.next_chunk_blocks = first_chunk_blocks;
+		cls.free_list = nullptr;
+		cls.cursor = cls.limit = nullptr;
+	}
+
+//-------------- Class Pool_allocator Implementation --------------//
+	template<typename T>
+	Pool_allocator<T>::Pool_allocator() :m_pool{std::make_shared<Node_pool>()} {}
+
+	template<typename T>
+	Pool_allocator<T>::Pool_allocator(std::shared_ptr<Node_pool> pool) noexcept :m_pool{std::move(pool)} {}
+
+	template<typename T>
+	template<typename U>
+	Pool_allocator<T>::Pool_allocator(const Pool_allocator<U> &other) noexcept :m_pool{other.pool()} {}
+
+	template<typename T>
+	T *Pool_allocator<T>::allocate(std::size_t count) {
+		if (pooled(count)) {
+			return static_cast<T *>(m_pool->allocate(sizeof(T)));
+		}
+		return std::allocator<T>{}.allocate(count);
+	}
+
+	template<typename T>
+	void Pool_allocator<T>::deallocate(T *data, std::size_t count) noexcept {
+		if (pooled(count)) {
+			m_pool->deallocate(data, sizeof(T));
+		} else {
+			std::allocator<T>{}.deallocate(data, count);
+		}
+	}
+
+	template<typename T>
+	Pool_allocator<T> Pool_allocator<T>::select_on_container_copy_construction() const {
+		return Pool_allocator{};
+	}
+
+	template<typename T>
+	const std::shared_ptr<Node_pool> &Pool_allocator<T>::pool() const noexcept {
+		return m_pool;
+	}
+
+	template<typename T>
+	template<typename U>
+	bool Pool_allocator<T>::operator==(const Pool_allocator<U> &other) const noexcept {
+		return m_pool == other.pool();
+	}
+
+	template<typename T>
+	template<typename U>
+	bool Pool_allocator<T>::operator!=(const Pool_allocator<U> &other) const noexcept {
+		return !(*this == other);
+	}
+
+	// private member function
+	template<typename T>
+	constexpr bool Pool_allocator<T>::pooled(std::size_t count) noexcept {
+		return count == 1 && alignof(T) <= alignof(std::max_align_t);
+	}
+} // namespace container
@@ -0,0 +1,211 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <optional>
+#include <vector>
+#include <utility>
+#include "Thread_pool.hpp"
+#include "Vector.hpp"
+
+namespace container {
+namespace parallel {
+
+    // How an algorithm splits its Vector. Ranges shorter than
+    // sequential_threshold run on the calling thread alone; others are cut in
+    // chunks of `grain` elements, by default four chunks per thread of the pool.
+    struct Options {
+        std::size_t grain = 0;
+        std::size_t sequential_threshold = 1 << 15;
+        Thread_pool *pool = nullptr; // default_pool() when not set
+    };
+
+    namespace detail {
+        // Chunking of [0, size) chosen from the options
+        struct Partition {
+            Thread_pool *pool;
+            std::size_t grain;
+            std::size_t chunks;
+
+            bool sequential() const noexcept {
+                return chunks <= 1;
+            }
+
+            std::size_t first(std::size_t chunk) const noexcept {
+                return chunk * grain;
+            }
+
+            std::size_t last(std::size_t chunk, std::size_t size) const noexcept {
+                return std::min(size, (chunk + 1) * grain);
+            }
+        };
+
+        inline Partition partition(std::size_t size, const Options &options) {
+            Thread_pool &pool = options.pool ? *options.pool : default_pool();
+            if (size < options.sequential_threshold || pool.concurrency() == 1){
+                return Partition{&pool, size, 1};
+            }
+            std::size_t grain = options.grain;
+            if (grain == 0){
+                const std::size_t chunks = 4 * pool.concurrency();
+                grain = (size + chunks - 1) / chunks;
+            }
+            return Partition{&pool, grain, (size + grain - 1) / grain};
+        }
+
+        // index of the first element matching pred, size when there is none
+        template<typename T, class UnaryPredicate>
+        std::size_t find_index(const T *data, std::size_t size, UnaryPredicate pred, const Options &options) {
+            const Partition parts = partition(size, options);
+            if (parts.sequential()){
+                return static_cast<std::size_t>(std::find_if(data, data + size, pred) - data);
+            }
+            // chunks past an earlier match stop, the lowest match wins
+            std::atomic<std::size_t> found{size};
+            parts.pool->run_chunks(parts.chunks, [&](std::size_t chunk){
+                const std::size_t first = parts.first(chunk);
+                const std::size_t last = parts.last(chunk, size);
+                for (std::size_t i = first; i < last && i < found.load(std::memory_order_relaxed); ++i){
+                    if (pred(data[i])){
+                        std::size_t current = found.load(std::memory_order_relaxed);
+                        while (i < current && !found.compare_exchange_weak(current, i, std::memory_order_relaxed)) {}
+                        return;
+                    }
+                }
+            });
+            return found.load(std::memory_order_relaxed);
+        }
+    } // namespace detail
+
+    // fn(element) for every element, in no particular order
+    template<typename T, typename Allocator, typename Growth, class Fn>
+    void for_each(Vector<T, Allocator, Growth> &vector, Fn fn, const Options &options = Options()) {
+        T *data = vector.data();
+        const std::size_t size = vector.size();
+        const detail::Partition parts = detail::partition(size, options);
+        if (parts.sequential()){
+            std::for_each(data, data + size, fn);
+            return;
+        }
+        parts.pool->run_chunks(parts.chunks, [&](std::size_t chunk){
+            std::for_each(data + parts.first(chunk), data + parts.last(chunk, size), fn);
+        });
+    }
+
+    // out[i] = op(in[i]), out is rebuilt with the size of in if it differs
+    template<typename T, typename A1, typename G1, typename U, typename A2, typename G2, class UnaryOperation>
+    void transform(const Vector<T, A1, G1> &in, Vector<U, A2, G2> &out, UnaryOperation op, const Options &options = Options()) {
+        const std::size_t size = in.size();
+        if (out.size() != size){
+            out = Vector<U, A2, G2>(size, out.get_allocator());
+        }
+        const T *from = in.data();
+        U *to = out.data();
+        const detail::Partition parts = detail::partition(size, options);
+        if (parts.sequential()){
+            std::transform(from, from + size, to, op);
+            return;
+        }
+        parts.pool->run_chunks(parts.chunks, [&](std::size_t chunk){
+            const std::size_t first = parts.first(chunk);
+            std::transform(from + first, from + parts.last(chunk, size), to + first, op);
+        });
+    }
+
+    // element = op(element) for every element
+    template<typename T, typename Allocator, typename Growth, class UnaryOperation>
+    void transform(Vector<T, Allocator, Growth> &vector, UnaryOperation op, const Options &options = Options()) {
+        for_each(vector, [&op](T &element){ element = op(element); }, options);
+    }
+
+    // Folds the elements with op, which must be associative: every chunk is
+    // folded on its own and the partial results are folded in order
+    template<typename T, typename Allocator, typename Growth, typename U, class BinaryOperation = std::plus<>>
+    U reduce(const Vector<T, Allocator, Growth> &vector, U init, BinaryOperation op = BinaryOperation(), const Options &options = Options()) {
+        const T *data = vector.data();
+        const std::size_t size = vector.size();
+        const detail::Partition parts = detail::partition(size, options);
+        if (parts.sequential()){
+            for (std::size_t i = 0; i < size; ++i){
+                init = op(std::move(init), data[i]);
+            }
+            return init;
+        }
+        std::vector<std::optional<U>> partial(parts.chunks);
+        parts.pool->run_chunks(parts.chunks, [&](std::size_t chunk){
+            const std::size_t first = parts.first(chunk);
+            const std::size_t last = parts.last(chunk, size);
+            if (first == last){
+                return;
+            }
+            U sum = data[first];
+            for (std::size_t i = first + 1; i < last; ++i){
+                sum = op(std::move(sum), data[i]);
+            }
+            partial[chunk] = std::move(sum);
+        });
+        for (std::size_t chunk = 0; chunk < parts.chunks; ++chunk){
+            if (partial[chunk]){
+                init = op(std::move(init), std::move(*partial[chunk]));
+            }
+        }
+        return init;
+    }
+
+    // first element matching pred, end() when there is none
+    template<typename T, typename Allocator, typename Growth, class UnaryPredicate>
+    typename Vector<T, Allocator, Growth>::iterator find_if(Vector<T, Allocator, Growth> &vector, UnaryPredicate pred, const Options &options = Options()) {
+        const std::size_t index = detail::find_index(vector.data(), vector.size(), pred, options);
+        return vector.begin() + static_cast<std::ptrdiff_t>(index);
+    }
+
+    template<typename T, typename Allocator, typename Growth, class UnaryPredicate>
+    typename Vector<T, Allocator, Growth>::const_iterator find_if(const Vector<T, Allocator, Growth> &vector, UnaryPredicate pred, const Options &options = Options()) {
+        const std::size_t index = detail::find_index(vector.data(), vector.size(), pred, options);
+        return vector.begin() + static_cast<std::ptrdiff_t>(index);
+    }
+
+    template<typename T, typename Allocator, typename Growth, class UnaryPredicate>
+    std::size_t count_if(const Vector<T, Allocator, Growth> &vector, UnaryPredicate pred, const Options &options = Options()) {
+        const T *data = vector.data();
+        const std::size_t size = vector.size();
+        const detail::Partition parts = detail::partition(size, options);
+        if (parts.sequential()){
+            return static_cast<std::size_t>(std::count_if(data, data + size, pred));
+        }
+        std::atomic<std::size_t> count{0};
+        parts.pool->run_chunks(parts.chunks, [&](std::size_t chunk){
+            const auto found = std::count_if(data + parts.first(chunk), data + parts.last(chunk, size), pred);
+            count.fetch_add(static_cast<std::size_t>(found), std::memory_order_relaxed);
+        });
+        return count.load(std::memory_order_relaxed);
+    }
+
+    // Sorts the chunks in parallel, then merges neighbouring runs in rounds,
+    // the runs of one round in parallel. Not stable.
+    template<typename T, typename Allocator, typename Growth, class Compare = std::less<>>
+    void sort(Vector<T, Allocator, Growth> &vector, Compare comp = Compare(), const Options &options = Options()) {
+        T *data = vector.data();
+        const std::size_t size = vector.size();
+        const detail::Partition parts = detail::partition(size, options);
+        if (parts.sequential()){
+            std::sort(data, data + size, comp);
+            return;
+        }
+        parts.pool->run_chunks(parts.chunks, [&](std::size_t chunk){
+            std::sort(data + parts.first(chunk), data + parts.last(chunk, size), comp);
+        });
+        for (std::size_t run = parts.grain; run < size; run *= 2){
+            const std::size_t merges = (size + 2 * run - 1) / (2 * run);
+            parts.pool->run_chunks(merges, [&](std::size_t merge){
+                const std::size_t first = merge * 2 * run;
+                const std::size_t middle = std::min(size, first + run);
+                const std::size_t last = std::min(size, first + 2 * run);
+                std::inplace_merge(data + first, data + middle, data + last, comp);
+            });
+        }
+    }
+
+} // namespace parallel
+} // namespace container
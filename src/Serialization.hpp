@@ -0,0 +1,531 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <unistd.h>
+#include "Vector.hpp"
+#include "List.hpp"
+#include "Forward_list.hpp"
+
+// Binary format of Vector, List and Forward_list, version 1. A container is
+// written as a 32 byte header followed by its elements:
+//
+//   magic "CNTR" | version u8 | kind u8 | encoding u8 | 0 u8
+//   element size u32 | 0 u32 | element count u64 | 0 u64
+//
+// Trivially copyable elements use the raw encoding: their bytes, one after
+// the other, copied in bulk. Other elements use the prefixed encoding: every
+// element is its byte length (u64) followed by what Codec<T> writes for it.
+// Numbers are in the byte order of the machine that wrote them.
+
+namespace container {
+
+    // Encoding of a type that is not trivially copyable: a specialization
+    // provides static void write(Binary_writer &, const T &) and static
+    // T read(Binary_reader &). std::basic_string and the containers of this
+    // library have one, so they nest.
+    template<typename T, typename = void>
+    struct Codec;
+
+    // Buffered output to a file descriptor. Element length prefixes are
+    // filled in inside the buffer, which grows rather than being written out
+    // while one is open. Large blocks skip the buffer.
+    class Binary_writer {
+    public:
+        explicit Binary_writer(int fd, std::size_t buffer_size = 1 << 16);
+        Binary_writer(const Binary_writer &other) = delete;
+        Binary_writer &operator=(const Binary_writer &other) = delete;
+        ~Binary_writer(); // writes what is left, errors are lost: call flush() to see them
+
+        void write_bytes(const void *bytes, std::size_t count);
+        template<typename T>
+        void write(const T &value); // trivially copyable T, as its bytes
+        std::size_t begin_length(); // reserves a u64 length, returns its position
+        void end_length(std::size_t position); // stores the bytes written since begin_length
+        void flush();
+
+    private:
+        void write_fd(const char *bytes, std::size_t count);
+
+    private: // members
+        int m_fd;
+        std::vector<char> m_buffer;
+        std::size_t m_used;
+        std::size_t m_open_lengths;
+    };
+
+    // Buffered input from a file descriptor. It may read past the end of the
+    // container being read, so read the following ones through the same reader.
+    class Binary_reader {
+    public:
+        explicit Binary_reader(int fd, std::size_t buffer_size = 1 << 16);
+        Binary_reader(const Binary_reader &other) = delete;
+        Binary_reader &operator=(const Binary_reader &other) = delete;
+
+        void read_bytes(void *bytes, std::size_t count);
+        template<typename T>
+        T read(); // trivially copyable T, from its bytes
+        std::uint64_t consumed() const noexcept; // bytes handed out so far
+
+    private:
+        std::size_t read_fd(char *bytes, std::size_t count);
+
+    private: // members
+        int m_fd;
+        std::vector<char> m_buffer;
+        std::size_t m_begin;
+        std::size_t m_end;
+        std::uint64_t m_consumed;
+    };
+
+    namespace binary {
+        constexpr std::uint8_t format_version = 1;
+        constexpr std::size_t header_size = 32;
+
+        enum class Kind : std::uint8_t { vector = 1, list = 2, forward_list = 3 };
+        enum class Encoding : std::uint8_t { raw = 0, prefixed = 1 };
+
+        struct Header {
+            Kind kind;
+            Encoding encoding;
+            std::uint32_t element_size;
+            std::uint64_t count;
+        };
+
+        template<typename T>
+        constexpr Encoding encoding_of = std::is_trivially_copyable<T>::value ? Encoding::raw : Encoding::prefixed;
+
+        // the 32 header bytes in a buffer, shared by the writer and the views
+        inline void encode_header(const Header &header, char (&bytes)[header_size]) {
+            std::memset(bytes, 0, header_size);
+            std::memcpy(bytes, "CNTR", 4);
+            bytes[4] = static_cast<char>(format_version);
+            bytes[5] = static_cast<char>(header.kind);
+            bytes[6] = static_cast<char>(header.encoding);
+            std::memcpy(bytes + 8, &header.element_size, sizeof(header.element_size));
+            std::memcpy(bytes + 16, &header.count, sizeof(header.count));
+        }
+
+        inline Header decode_header(const char *bytes) {
+            if (std::memcmp(bytes, "CNTR", 4) != 0){
+                throw std::runtime_error("ERROR: not a container binary");
+            }
+            if (static_cast<std::uint8_t>(bytes[4]) > format_version){
+                throw std::runtime_error("ERROR: container binary version " + std::to_string(static_cast<unsigned>(static_cast<std::uint8_t>(bytes[4]))) + " is newer than this library");
+            }
+            Header header;
+            header.kind = static_cast<Kind>(bytes[5]);
+            header.encoding = static_cast<Encoding>(bytes[6]);
+            std::memcpy(&header.element_size, bytes + 8, sizeof(header.element_size));
+            std::memcpy(&header.count, bytes + 16, sizeof(header.count));
+            return header;
+        }
+
+        template<typename T>
+        void write_header(Binary_writer &writer, Kind kind, std::size_t count) {
+            char bytes[header_size];
+            encode_header(Header{kind, encoding_of<T>, static_cast<std::uint32_t>(sizeof(T)), count}, bytes);
+            writer.write_bytes(bytes, header_size);
+        }
+
+        // reads a header and checks that it describes a container of T of that kind
+        template<typename T>
+        std::uint64_t read_header(Binary_reader &reader, Kind kind) {
+            char bytes[header_size];
+            reader.read_bytes(bytes, header_size);
+            const Header header = decode_header(bytes);
+            if (header.kind != kind){
+                throw std::runtime_error("ERROR: container binary holds another kind of container");
+            }
+            if (header.encoding != encoding_of<T> || (header.encoding == Encoding::raw && header.element_size != sizeof(T))){
+                throw std::runtime_error("ERROR: container binary holds another element type");
+            }
+            return header.count;
+        }
+
+        template<typename T>
+        void write_element(Binary_writer &writer, const T &value) {
+            if constexpr (std::is_trivially_copyable<T>::value){
+                writer.write(value);
+            } else {
+                const std::size_t length = writer.begin_length();
+                Codec<T>::write(writer, value);
+                writer.end_length(length);
+            }
+        }
+
+        template<typename T>
+        T read_element(Binary_reader &reader) {
+            if constexpr (std::is_trivially_copyable<T>::value){
+                return reader.read<T>();
+            } else {
+                const auto length = reader.read<std::uint64_t>();
+                const std::uint64_t start = reader.consumed();
+                T value = Codec<T>::read(reader);
+                if (reader.consumed() - start != length){
+                    throw std::runtime_error("ERROR: container binary element has a wrong length");
+                }
+                return value;
+            }
+        }
+
+        // elements of a list, in order
+        template<typename T, class Sequence>
+        void write_nodes(Binary_writer &writer, Kind kind, const Sequence &list) {
+            write_header<T>(writer, kind, list.size());
+            for (const auto &value : list){
+                write_element(writer, value);
+            }
+        }
+
+        template<typename T, class Sequence>
+        void read_nodes(Binary_reader &reader, Kind kind, Sequence &list) {
+            const std::uint64_t count = read_header<T>(reader, kind);
+            Sequence result(list.get_allocator());
+            for (std::uint64_t i = 0; i < count; ++i){
+                result.emplace_back(read_element<T>(reader));
+            }
+            list.swap(result);
+        }
+    } // namespace binary
+
+    //---------------- Serialization of the containers ----------------//
+    // Trivially copyable elements are written straight from the Vector's storage
+    template<typename T, typename Allocator, typename Growth>
+    void serialize(Binary_writer &writer, const Vector<T, Allocator, Growth> &vector) {
+        binary::write_header<T>(writer, binary::Kind::vector, vector.size());
+        if constexpr (std::is_trivially_copyable<T>::value){
+            writer.write_bytes(vector.data(), vector.size() * sizeof(T));
+        } else {
+            for (const auto &value : vector){
+                binary::write_element(writer, value);
+            }
+        }
+    }
+
+    template<typename T, typename Allocator>
+    void serialize(Binary_writer &writer, const List<T, Allocator> &list) {
+        binary::write_nodes<T>(writer, binary::Kind::list, list);
+    }
+
+    template<typename T, typename Allocator>
+    void serialize(Binary_writer &writer, const Forward_list<T, Allocator> &list) {
+        binary::write_nodes<T>(writer, binary::Kind::forward_list, list);
+    }
+
+    // Replaces the elements of vector by the ones read. Trivially copyable
+    // elements are read straight into the Vector's storage.
+    template<typename T, typename Allocator, typename Growth>
+    void deserialize(Binary_reader &reader, Vector<T, Allocator, Growth> &vector) {
+        const std::uint64_t count = binary::read_header<T>(reader, binary::Kind::vector);
+        if constexpr (std::is_trivially_copyable<T>::value && std::is_default_constructible<T>::value){
+            Vector<T, Allocator, Growth> result(static_cast<std::size_t>(count), vector.get_allocator());
+            reader.read_bytes(result.data(), static_cast<std::size_t>(count) * sizeof(T));
+            vector.swap(result);
+        } else {
+            Vector<T, Allocator, Growth> result(vector.get_allocator());
+            result.reserve(static_cast<std::size_t>(count));
+            for (std::uint64_t i = 0; i < count; ++i){
+                result.emplace_back(binary::read_element<T>(reader));
+            }
+            vector.swap(result);
+        }
+    }
+
+    template<typename T, typename Allocator>
+    void deserialize(Binary_reader &reader, List<T, Allocator> &list) {
+        binary::read_nodes<T>(reader, binary::Kind::list, list);
+    }
+
+    template<typename T, typename Allocator>
+    void deserialize(Binary_reader &reader, Forward_list<T, Allocator> &list) {
+        binary::read_nodes<T>(reader, binary::Kind::forward_list, list);
+    }
+
+    //---------------- Codecs ----------------//
+    // characters of a string, their count is the element length
+    template<typename Char, typename Traits, typename Allocator>
+    struct Codec<std::basic_string<Char, Traits, Allocator>> {
+        using string_type = std::basic_string<Char, Traits, Allocator>;
+
+        static void write(Binary_writer &writer, const string_type &value) {
+            writer.write<std::uint64_t>(value.size());
+            writer.write_bytes(value.data(), value.size() * sizeof(Char));
+        }
+
+        static string_type read(Binary_reader &reader) {
+            string_type value(static_cast<std::size_t>(reader.read<std::uint64_t>()), Char());
+            reader.read_bytes(&value[0], value.size() * sizeof(Char));
+            return value;
+        }
+    };
+
+    // containers nest: an element holds a whole serialized container
+    template<typename T, typename Allocator, typename Growth>
+    struct Codec<Vector<T, Allocator, Growth>> {
+        static void write(Binary_writer &writer, const Vector<T, Allocator, Growth> &value) {
+            serialize(writer, value);
+        }
+
+        static Vector<T, Allocator, Growth> read(Binary_reader &reader) {
+            Vector<T, Allocator, Growth> value;
+            deserialize(reader, value);
+            return value;
+        }
+    };
+
+    template<typename T, typename Allocator>
+    struct Codec<List<T, Allocator>> {
+        static void write(Binary_writer &writer, const List<T, Allocator> &value) {
+            serialize(writer, value);
+        }
+
+        static List<T, Allocator> read(Binary_reader &reader) {
+            List<T, Allocator> value;
+            deserialize(reader, value);
+            return value;
+        }
+    };
+
+    template<typename T, typename Allocator>
+    struct Codec<Forward_list<T, Allocator>> {
+        static void write(Binary_writer &writer, const Forward_list<T, Allocator> &value) {
+            serialize(writer, value);
+        }
+
+        static Forward_list<T, Allocator> read(Binary_reader &reader) {
+            Forward_list<T, Allocator> value;
+            deserialize(reader, value);
+            return value;
+        }
+    };
+
+    //---------------- Vector_view ----------------//
+    // Read-only Vector over the elements of a raw encoded container binary
+    // already in memory (read into a buffer or mapped): nothing is copied, so
+    // the buffer must outlive the view. The elements must be aligned for T in
+    // the buffer, which holds when the buffer itself is.
+    template<typename T>
+    class Vector_view {
+        static_assert(std::is_trivially_copyable<T>::value, "only raw encoded elements can be viewed");
+
+    public:
+        using value_type = T;
+        using const_iterator = const T*;
+
+        Vector_view() noexcept;
+        Vector_view(const void *buffer, std::size_t bytes);
+
+        const T &at(std::size_t index) const;
+        const T &operator[](std::size_t index) const;
+        const T *data() const noexcept;
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
+        bool empty() const noexcept;
+        std::size_t size() const noexcept;
+
+    private: // members
+        const T *m_data;
+        std::size_t m_size;
+    };
+
+//-------------- Class Binary_writer Implementation ------------//
+    inline Binary_writer::Binary_writer(int fd, std::size_t buffer_size)
+        :m_fd{fd}, m_buffer(buffer_size ? buffer_size : 1), m_used{0}, m_open_lengths{0} {}
+
+    inline Binary_writer::~Binary_writer(){
+        try {
+            flush();
+        } catch (...) {
+        }
+    }
+
+    inline void Binary_writer::write_bytes(const void *bytes, std::size_t count){
+        const char *from = static_cast<const char *>(bytes);
+        if (m_used + count > m_buffer.size()){
+            if (m_open_lengths == 0){
+                flush();
+                if (count >= m_buffer.size()){
+                    write_fd(from, count);
+                    return;
+                }
+            } else {
+                m_buffer.resize(std::max(2 * m_buffer.size(), m_used + count));
+            }
+        }
+        if (count){
+            std::memcpy(m_buffer.data() + m_used, from, count);
+        }
+        m_used += count;
+    }
+
+    template<typename T>
+    void Binary_writer::write(const T &value){
+        static_assert(std::is_trivially_copyable<T>::value, "write() takes trivially copyable values");
+        write_bytes(&value, sizeof(T));
+    }
+
+    // the placeholder goes to the buffer even when it is small or full, so
+    // that end_length finds it there
+    inline std::size_t Binary_writer::begin_length(){
+        if (m_open_lengths == 0 && m_used + sizeof(std::uint64_t) > m_buffer.size()){
+            flush();
+        }
+        ++m_open_lengths;
+        write<std::uint64_t>(0);
+        return m_used - sizeof(std::uint64_t);
+    }
+
+    inline void Binary_writer::end_length(std::size_t position){
+        const std::uint64_t length = m_used - position - sizeof(std::uint64_t);
+        std::memcpy(m_buffer.data() + position, &length, sizeof(length));
+        --m_open_lengths;
+    }
+
+    inline void Binary_writer::flush(){
+        if (m_open_lengths == 0 && m_used){
+            write_fd(m_buffer.data(), m_used);
+            m_used = 0;
+        }
+    }
+
+    // private member function, retries partial and interrupted writes
+    inline void Binary_writer::write_fd(const char *bytes, std::size_t count){
+        while (count){
+            const ssize_t written = ::write(m_fd, bytes, count);
+            if (written < 0){
+                if (errno == EINTR){
+                    continue;
+                }
+                throw std::runtime_error("ERROR: cannot write container binary: " + std::string(std::strerror(errno)));
+            }
+            bytes += written;
+            count -= static_cast<std::size_t>(written);
+        }
+    }
+
+//-------------- Class Binary_reader Implementation ------------//
+    inline Binary_reader::Binary_reader(int fd, std::size_t buffer_size)
+        :m_fd{fd}, m_buffer(buffer_size ? buffer_size : 1), m_begin{0}, m_end{0}, m_consumed{0} {}
+
+    inline void Binary_reader::read_bytes(void *bytes, std::size_t count){
+        char *to = static_cast<char *>(bytes);
+        m_consumed += count;
+        while (count){
+            if (m_begin == m_end){
+                if (count >= m_buffer.size()){
+                    // large block: straight into the destination
+                    const std::size_t got = read_fd(to, count);
+                    to += got;
+                    count -= got;
+                    continue;
+                }
+                m_begin = 0;
+                m_end = read_fd(m_buffer.data(), m_buffer.size());
+            }
+            const std::size_t taken = std::min(count, m_end - m_begin);
+            std::memcpy(to, m_buffer.data() + m_begin, taken);
+            m_begin += taken;
+            to += taken;
+            count -= taken;
+        }
+    }
+
+    template<typename T>
+    T Binary_reader::read(){
+        static_assert(std::is_trivially_copyable<T>::value, "read() returns trivially copyable values");
+        T value;
+        read_bytes(&value, sizeof(T));
+        return value;
+    }
+
+    inline std::uint64_t Binary_reader::consumed() const noexcept {
+        return m_consumed;
+    }
+
+    // private member function, at least one byte or an exception
+    inline std::size_t Binary_reader::read_fd(char *bytes, std::size_t count){
+        for (;;){
+            const ssize_t got = ::read(m_fd, bytes, count);
+            if (got > 0){
+                return static_cast<std::size_t>(got);
+            }
+            if (got == 0){
+                throw std::runtime_error("ERROR: container binary ends early");
+            }
+            if (errno != EINTR){
+                throw std::runtime_error("ERROR: cannot read container binary: " + std::string(std::strerror(errno)));
+            }
+        }
+    }
+
+//-------------- Class Vector_view Implementation ------------//
+    template<typename T>
+    Vector_view<T>::Vector_view() noexcept :m_data{nullptr}, m_size{0} {}
+
+    template<typename T>
+    Vector_view<T>::Vector_view(const void *buffer, std::size_t bytes) :m_data{nullptr}, m_size{0} {
+        if (bytes < binary::header_size){
+            throw std::runtime_error("ERROR: container binary ends early");
+        }
+        const char *start = static_cast<const char *>(buffer);
+        const binary::Header header = binary::decode_header(start);
+        if (header.encoding != binary::Encoding::raw || header.element_size != sizeof(T)){
+            throw std::runtime_error("ERROR: container binary holds another element type");
+        }
+        if (header.count > (bytes - binary::header_size) / sizeof(T)){
+            throw std::runtime_error("ERROR: container binary ends early");
+        }
+        const char *elements = start + binary::header_size;
+        if (reinterpret_cast<std::uintptr_t>(elements) % alignof(T) != 0){
+            throw std::runtime_error("ERROR: container binary is not aligned for its elements");
+        }
+        m_data = reinterpret_cast<const T *>(elements);
+        m_size = static_cast<std::size_t>(header.count);
+    }
+
+    template<typename T>
+    const T &Vector_view<T>::at(std::size_t index) const {
+        if (index >= m_size){
+            throw std::out_of_range("ERROR: Index out of bounds in Vector_view");
+        }
+        return m_data[index];
+    }
+
+    template<typename T>
+    const T &Vector_view<T>::operator[](std::size_t index) const {
+        return m_data[index];
+    }
+
+    template<typename T>
+    const T *Vector_view<T>::data() const noexcept {
+        return m_data;
+    }
+
+    template<typename T>
+    typename Vector_view<T>::const_iterator Vector_view<T>::begin() const noexcept {
+        return m_data;
+    }
+
+    template<typename T>
+    typename Vector_view<T>::const_iterator Vector_view<T>::end() const noexcept {
+        return m_data + m_size;
+    }
+
+    template<typename T>
+    bool Vector_view<T>::empty() const noexcept {
+        return m_size == 0;
+    }
+
+    template<typename T>
+    std::size_t Vector_view<T>::size() const noexcept {
+        return m_size;
+    }
+
+} // namespace container
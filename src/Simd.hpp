@@ -0,0 +1,468 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+// x86 builds with GCC or Clang get the vector kernels: SSE2, which every
+// x86-64 processor has, and AVX2, picked at run time when the processor
+// supports it. Other targets, or builds defining CONTAINER_NO_SIMD, use the
+// std algorithms.
+#if !defined(CONTAINER_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define CONTAINER_SIMD_X86 1
+#include <immintrin.h>
+#define CONTAINER_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#endif
+
+namespace container {
+namespace simd {
+
+    // Element types the kernels handle: integers and floating point types of
+    // 1, 2, 4 or 8 bytes. bool and long double go through the std algorithms.
+    template<typename T>
+    struct is_vectorizable : std::integral_constant<bool,
+        std::is_arithmetic<T>::value && !std::is_same<T, bool>::value &&
+        (std::is_integral<T>::value ? sizeof(T) <= 8 : std::is_same<T, float>::value || std::is_same<T, double>::value)> {};
+
+    namespace detail {
+        template<typename T>
+        bool is_nan(const T &value) {
+            if constexpr (std::is_floating_point<T>::value){
+                return value != value;
+            } else {
+                return false;
+            }
+        }
+
+        // Smallest (or greatest) of the lanes and of [first, last). false when
+        // one of them is NaN: the caller then falls back to the std algorithm,
+        // whose answer depends on where the NaN is.
+        template<bool Greatest, typename T, std::size_t Lanes>
+        bool fold_extreme(const T (&lanes)[Lanes], const T *first, const T *last, T &best) {
+            best = lanes[0];
+            for (std::size_t i = 0; i < Lanes; ++i){
+                if (is_nan(lanes[i])){
+                    return false;
+                }
+                if (Greatest ? best < lanes[i] : lanes[i] < best){
+                    best = lanes[i];
+                }
+            }
+            for (; first != last; ++first){
+                if (is_nan(*first)){
+                    return false;
+                }
+                if (Greatest ? best < *first : *first < best){
+                    best = *first;
+                }
+            }
+            return true;
+        }
+
+#ifdef CONTAINER_SIMD_X86
+        inline bool has_avx2() noexcept {
+            static const bool supported = __builtin_cpu_supports("avx2");
+            return supported;
+        }
+
+        // Unsigned integers are compared as signed ones once their top bit is flipped
+        template<typename T>
+        constexpr bool needs_bias = std::is_integral<T>::value && std::is_unsigned<T>::value;
+
+        //-------------- SSE2 ------------//
+        namespace sse2 {
+            // 16 bytes per register, floating point lanes are kept in integer registers
+            template<typename T>
+            struct Ops {
+                using reg = __m128i;
+                static constexpr std::ptrdiff_t lanes = 16 / sizeof(T);
+                static constexpr unsigned full_mask = 0xFFFF;
+                // no 64 bit integer ordering before SSE4.2
+                static constexpr bool has_order = !(std::is_integral<T>::value && sizeof(T) == 8);
+
+                static reg load(const T *from) {
+                    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(from));
+                }
+
+                static void store(T *to, reg value) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(to), value);
+                }
+
+                static reg broadcast(T value) {
+                    if constexpr (std::is_same<T, float>::value){
+                        return _mm_castps_si128(_mm_set1_ps(value));
+                    } else if constexpr (std::is_same<T, double>::value){
+                        return _mm_castpd_si128(_mm_set1_pd(value));
+                    } else if constexpr (sizeof(T) == 1){
+                        return _mm_set1_epi8(static_cast<char>(value));
+                    } else if constexpr (sizeof(T) == 2){
+                        return _mm_set1_epi16(static_cast<short>(value));
+                    } else if constexpr (sizeof(T) == 4){
+                        return _mm_set1_epi32(static_cast<int>(value));
+                    } else {
+                        return _mm_set1_epi64x(static_cast<long long>(value));
+                    }
+                }
+
+                // all ones in the lanes where a == b
+                static reg equal(reg a, reg b) {
+                    if constexpr (std::is_same<T, float>::value){
+                        return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+                    } else if constexpr (std::is_same<T, double>::value){
+                        return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+                    } else if constexpr (sizeof(T) == 1){
+                        return _mm_cmpeq_epi8(a, b);
+                    } else if constexpr (sizeof(T) == 2){
+                        return _mm_cmpeq_epi16(a, b);
+                    } else if constexpr (sizeof(T) == 4){
+                        return _mm_cmpeq_epi32(a, b);
+                    } else {
+                        // both 32 bit halves equal
+                        const reg halves = _mm_cmpeq_epi32(a, b);
+                        return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+                    }
+                }
+
+                // all ones in the lanes where a < b
+                static reg less(reg a, reg b) {
+                    if constexpr (std::is_same<T, float>::value){
+                        return _mm_castps_si128(_mm_cmplt_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+                    } else if constexpr (std::is_same<T, double>::value){
+                        return _mm_castpd_si128(_mm_cmplt_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+                    } else {
+                        if constexpr (needs_bias<T>){
+                            const reg bias = broadcast(static_cast<T>(T(1) << (8 * sizeof(T) - 1)));
+                            a = _mm_xor_si128(a, bias);
+                            b = _mm_xor_si128(b, bias);
+                        }
+                        if constexpr (sizeof(T) == 1){
+                            return _mm_cmplt_epi8(a, b);
+                        } else if constexpr (sizeof(T) == 2){
+                            return _mm_cmplt_epi16(a, b);
+                        } else {
+                            return _mm_cmplt_epi32(a, b);
+                        }
+                    }
+                }
+
+                static reg select(reg mask, reg a, reg b) {
+                    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+                }
+
+                // one bit per byte
+                static unsigned bits(reg mask) {
+                    return static_cast<unsigned>(_mm_movemask_epi8(mask));
+                }
+            };
+
+            template<typename T>
+            const T *find(const T *first, const T *last, T value) {
+                using V = Ops<T>;
+                const auto needle = V::broadcast(value);
+                for (; last - first >= V::lanes; first += V::lanes){
+                    const unsigned found = V::bits(V::equal(V::load(first), needle));
+                    if (found){
+                        return first + static_cast<std::size_t>(__builtin_ctz(found)) / sizeof(T);
+                    }
+                }
+                return std::find(first, last, value);
+            }
+
+            template<typename T>
+            std::size_t count(const T *first, const T *last, T value) {
+                using V = Ops<T>;
+                const auto needle = V::broadcast(value);
+                std::size_t bytes = 0;
+                for (; last - first >= V::lanes; first += V::lanes){
+                    bytes += static_cast<std::size_t>(__builtin_popcount(V::bits(V::equal(V::load(first), needle))));
+                }
+                return bytes / sizeof(T) + static_cast<std::size_t>(std::count(first, last, value));
+            }
+
+            // false when the range holds a NaN
+            template<bool Greatest, typename T>
+            bool extreme(const T *first, const T *last, T &best) {
+                using V = Ops<T>;
+                auto lanes = V::load(first);
+                for (first += V::lanes; last - first >= V::lanes; first += V::lanes){
+                    const auto next = V::load(first);
+                    lanes = Greatest ? V::select(V::less(lanes, next), next, lanes)
+                                     : V::select(V::less(next, lanes), next, lanes);
+                    if constexpr (std::is_floating_point<T>::value){
+                        // a NaN lane never wins a comparison, test the loaded values
+                        if (V::bits(V::equal(next, next)) != V::full_mask){
+                            return false;
+                        }
+                    }
+                }
+                T values[V::lanes];
+                V::store(values, lanes);
+                return fold_extreme<Greatest>(values, first, last, best);
+            }
+
+            template<typename T>
+            void fill(T *first, T *last, T value) {
+                using V = Ops<T>;
+                const auto filler = V::broadcast(value);
+                for (; last - first >= V::lanes; first += V::lanes){
+                    V::store(first, filler);
+                }
+                std::fill(first, last, value);
+            }
+
+            template<typename T>
+            bool equal(const T *first, const T *last, const T *other) {
+                using V = Ops<T>;
+                for (; last - first >= V::lanes; first += V::lanes, other += V::lanes){
+                    if (V::bits(V::equal(V::load(first), V::load(other))) != V::full_mask){
+                        return false;
+                    }
+                }
+                return std::equal(first, last, other);
+            }
+        } // namespace sse2
+
+        //-------------- AVX2 ------------//
+        // Same kernels on 32 byte registers, compiled for AVX2 whatever the
+        // flags of the build. They only run once has_avx2() returned true.
+        namespace avx2 {
+            template<typename T>
+            struct Ops {
+                using reg = __m256i;
+                static constexpr std::ptrdiff_t lanes = 32 / sizeof(T);
+                static constexpr unsigned full_mask = 0xFFFFFFFF;
+                static constexpr bool has_order = true;
+
+                CONTAINER_TARGET_AVX2 static reg load(const T *from) {
+                    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(from));
+                }
+
+                CONTAINER_TARGET_AVX2 static void store(T *to, reg value) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(to), value);
+                }
+
+                CONTAINER_TARGET_AVX2 static reg broadcast(T value) {
+                    if constexpr (std::is_same<T, float>::value){
+                        return _mm256_castps_si256(_mm256_set1_ps(value));
+                    } else if constexpr (std::is_same<T, double>::value){
+                        return _mm256_castpd_si256(_mm256_set1_pd(value));
+                    } else if constexpr (sizeof(T) == 1){
+                        return _mm256_set1_epi8(static_cast<char>(value));
+                    } else if constexpr (sizeof(T) == 2){
+                        return _mm256_set1_epi16(static_cast<short>(value));
+                    } else if constexpr (sizeof(T) == 4){
+                        return _mm256_set1_epi32(static_cast<int>(value));
+                    } else {
+                        return _mm256_set1_epi64x(static_cast<long long>(value));
+                    }
+                }
+
+                CONTAINER_TARGET_AVX2 static reg equal(reg a, reg b) {
+                    if constexpr (std::is_same<T, float>::value){
+                        return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+                    } else if constexpr (std::is_same<T, double>::value){
+                        return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+                    } else if constexpr (sizeof(T) == 1){
+                        return _mm256_cmpeq_epi8(a, b);
+                    } else if constexpr (sizeof(T) == 2){
+                        return _mm256_cmpeq_epi16(a, b);
+                    } else if constexpr (sizeof(T) == 4){
+                        return _mm256_cmpeq_epi32(a, b);
+                    } else {
+                        return _mm256_cmpeq_epi64(a, b);
+                    }
+                }
+
+                CONTAINER_TARGET_AVX2 static reg less(reg a, reg b) {
+                    if constexpr (std::is_same<T, float>::value){
+                        return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_LT_OQ));
+                    } else if constexpr (std::is_same<T, double>::value){
+                        return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_LT_OQ));
+                    } else {
+                        if constexpr (needs_bias<T>){
+                            const reg bias = broadcast(static_cast<T>(T(1) << (8 * sizeof(T) - 1)));
+                            a = _mm256_xor_si256(a, bias);
+                            b = _mm256_xor_si256(b, bias);
+                        }
+                        if constexpr (sizeof(T) == 1){
+                            return _mm256_cmpgt_epi8(b, a);
+                        } else if constexpr (sizeof(T) == 2){
+                            return _mm256_cmpgt_epi16(b, a);
+                        } else if constexpr (sizeof(T) == 4){
+                            return _mm256_cmpgt_epi32(b, a);
+                        } else {
+                            return _mm256_cmpgt_epi64(b, a);
+                        }
+                    }
+                }
+
+                CONTAINER_TARGET_AVX2 static reg select(reg mask, reg a, reg b) {
+                    return _mm256_blendv_epi8(b, a, mask);
+                }
+
+                CONTAINER_TARGET_AVX2 static unsigned bits(reg mask) {
+                    return static_cast<unsigned>(_mm256_movemask_epi8(mask));
+                }
+            };
+
+            template<typename T>
+            CONTAINER_TARGET_AVX2 const T *find(const T *first, const T *last, T value) {
+                using V = Ops<T>;
+                const auto needle = V::broadcast(value);
+                for (; last - first >= V::lanes; first += V::lanes){
+                    const unsigned found = V::bits(V::equal(V::load(first), needle));
+                    if (found){
+                        return first + static_cast<std::size_t>(__builtin_ctz(found)) / sizeof(T);
+                    }
+                }
+                return std::find(first, last, value);
+            }
+
+            template<typename T>
+            CONTAINER_TARGET_AVX2 std::size_t count(const T *first, const T *last, T value) {
+                using V = Ops<T>;
+                const auto needle = V::broadcast(value);
+                std::size_t bytes = 0;
+                for (; last - first >= V::lanes; first += V::lanes){
+                    bytes += static_cast<std::size_t>(__builtin_popcount(V::bits(V::equal(V::load(first), needle))));
+                }
+                return bytes / sizeof(T) + static_cast<std::size_t>(std::count(first, last, value));
+            }
+
+            template<bool Greatest, typename T>
+            CONTAINER_TARGET_AVX2 bool extreme(const T *first, const T *last, T &best) {
+                using V = Ops<T>;
+                auto lanes = V::load(first);
+                for (first += V::lanes; last - first >= V::lanes; first += V::lanes){
+                    const auto next = V::load(first);
+                    lanes = Greatest ? V::select(V::less(lanes, next), next, lanes)
+                                     : V::select(V::less(next, lanes), next, lanes);
+                    if constexpr (std::is_floating_point<T>::value){
+                        if (V::bits(V::equal(next, next)) != V::full_mask){
+                            return false;
+                        }
+                    }
+                }
+                T values[V::lanes];
+                V::store(values, lanes);
+                return fold_extreme<Greatest>(values, first, last, best);
+            }
+
+            template<typename T>
+            CONTAINER_TARGET_AVX2 void fill(T *first, T *last, T value) {
+                using V = Ops<T>;
+                const auto filler = V::broadcast(value);
+                for (; last - first >= V::lanes; first += V::lanes){
+                    V::store(first, filler);
+                }
+                std::fill(first, last, value);
+            }
+
+            template<typename T>
+            CONTAINER_TARGET_AVX2 bool equal(const T *first, const T *last, const T *other) {
+                using V = Ops<T>;
+                for (; last - first >= V::lanes; first += V::lanes, other += V::lanes){
+                    if (V::bits(V::equal(V::load(first), V::load(other))) != V::full_mask){
+                        return false;
+                    }
+                }
+                return std::equal(first, last, other);
+            }
+        } // namespace avx2
+#endif // CONTAINER_SIMD_X86
+
+        // Smallest or greatest element, first of them when several compare equal
+        template<bool Greatest, typename T>
+        const T *extreme_element(const T *first, const T *last) {
+            auto scalar = [first, last]{
+                return Greatest ? std::max_element(first, last) : std::min_element(first, last);
+            };
+#ifdef CONTAINER_SIMD_X86
+            T best{};
+            if (has_avx2()){
+                if (last - first >= 2 * avx2::Ops<T>::lanes && avx2::extreme<Greatest>(first, last, best)){
+                    return avx2::find(first, last, best);
+                }
+            } else if constexpr (sse2::Ops<T>::has_order){
+                if (last - first >= 2 * sse2::Ops<T>::lanes && sse2::extreme<Greatest>(first, last, best)){
+                    return sse2::find(first, last, best);
+                }
+            }
+#endif
+            return scalar();
+        }
+    } // namespace detail
+
+    // The functions below give the same results as the std algorithm of the
+    // same name. Arithmetic element types are compared several at a time.
+
+    template<typename T>
+    const T *find(const T *first, const T *last, const T &value) {
+#ifdef CONTAINER_SIMD_X86
+        if constexpr (is_vectorizable<T>::value){
+            return detail::has_avx2() ? detail::avx2::find(first, last, value) : detail::sse2::find(first, last, value);
+        }
+#endif
+        return std::find(first, last, value);
+    }
+
+    template<typename T>
+    std::size_t count(const T *first, const T *last, const T &value) {
+#ifdef CONTAINER_SIMD_X86
+        if constexpr (is_vectorizable<T>::value){
+            return detail::has_avx2() ? detail::avx2::count(first, last, value) : detail::sse2::count(first, last, value);
+        }
+#endif
+        return static_cast<std::size_t>(std::count(first, last, value));
+    }
+
+    template<typename T>
+    const T *min_element(const T *first, const T *last) {
+        if constexpr (is_vectorizable<T>::value){
+            return detail::extreme_element<false>(first, last);
+        }
+        return std::min_element(first, last);
+    }
+
+    template<typename T>
+    const T *max_element(const T *first, const T *last) {
+        if constexpr (is_vectorizable<T>::value){
+            return detail::extreme_element<true>(first, last);
+        }
+        return std::max_element(first, last);
+    }
+
+    template<typename T>
+    void fill(T *first, T *last, const T &value) {
+#ifdef CONTAINER_SIMD_X86
+        if constexpr (is_vectorizable<T>::value){
+            if (detail::has_avx2()){
+                detail::avx2::fill(first, last, value);
+            } else {
+                detail::sse2::fill(first, last, value);
+            }
+            return;
+        }
+#endif
+        std::fill(first, last, value);
+    }
+
+    // Integers are equal exactly when their bytes are, floating point values
+    // are compared lane by lane so that NaN != NaN and -0.0 == 0.0 still hold
+    template<typename T>
+    bool equal(const T *first, const T *last, const T *other) {
+        if constexpr (std::is_integral<T>::value){
+            return first == last || std::memcmp(first, other, static_cast<std::size_t>(last - first) * sizeof(T)) == 0;
+        }
+#ifdef CONTAINER_SIMD_X86
+        if constexpr (is_vectorizable<T>::value){
+            return detail::has_avx2() ? detail::avx2::equal(first, last, other) : detail::sse2::equal(first, last, other);
+        }
+#endif
+        return std::equal(first, last, other);
+    }
+
+} // namespace simd
+} // namespace container
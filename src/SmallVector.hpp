@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Vector.hpp"
+
+namespace container {
+
+    // Inline storage of a SmallVector, a base class so that it is built before
+    // the Vector that uses it and destroyed after it
+    template<typename T, std::size_t N>
+    class Small_storage {
+    protected:
+        Small_storage() noexcept;
+        Small_storage(const Small_storage &other) noexcept; // the storage itself is never copied
+        Small_storage &operator=(const Small_storage &other) noexcept;
+
+        Inline_buffer<T> m_buffer;
+        alignas(T) unsigned char m_storage[N * sizeof(T)];
+    };
+
+    // Vector keeping up to N elements inside the object before spilling to the heap
+    template<typename T, std::size_t N, typename Allocator = std::allocator<T>, typename Growth = Doubling_growth>
+    class SmallVector : private Small_storage<T, N>, public Vector<T, Allocator, Growth> {
+        static_assert(N > 0, "SmallVector needs an inline capacity");
+        using base = Vector<T, Allocator, Growth>;
+
+    public:
+        static constexpr std::size_t inline_capacity = N;
+
+        // Constructors and destructor
+        SmallVector();
+        explicit SmallVector(const Allocator &alloc);
+        explicit SmallVector(std::size_t count, const Allocator &alloc = Allocator());
+        SmallVector(std::initializer_list<T> elements, const Allocator &alloc = Allocator());
+        SmallVector(const SmallVector &other); // copy constructor
+        SmallVector(SmallVector &&other) noexcept(std::is_nothrow_move_constructible<T>::value); // move constructor
+        SmallVector &operator=(const SmallVector &other);
+        SmallVector &operator=(SmallVector &&other) noexcept(std::is_nothrow_move_constructible<T>::value && base::adopts_moved_storage);
+
+        // Capacity
+        bool is_small() const noexcept; // elements are held in the inline buffer
+    };
+
+//-------------- Class Small_storage Implementation ------------//
+    template<typename T, std::size_t N>
+    Small_storage<T, N>::Small_storage() noexcept :m_buffer{reinterpret_cast<T *>(m_storage), N} {}
+
+    template<typename T, std::size_t N>
+    Small_storage<T, N>::Small_storage(const Small_storage &) noexcept :Small_storage{} {}
+
+    template<typename T, std::size_t N>
+    Small_storage<T, N> &Small_storage<T, N>::operator=(const Small_storage &) noexcept {
+        return *this;
+    }
+
+//-------------- Class SmallVector Implementation ------------//
+    //------ Constructors ----------//
+    template<typename T, std::size_t N, typename Allocator, typename Growth>
+    SmallVector<T, N, Allocator, Growth>::SmallVector() :SmallVector{Allocator()} {}
+
+    template<typename T, std::size_t N, typename Allocator, typename Growth>
+    SmallVector<T, N, Allocator, Growth>::SmallVector(const Allocator &alloc)
+        :Small_storage<T, N>{}, base{&this->m_buffer, alloc} {}
+
+    template<typename T, std::size_t N, typename Allocator, typename Growth>
+    SmallVector<T, N, Allocator, Growth>::SmallVector(std::size_t count, const Allocator &alloc) :SmallVector{alloc} {
+        this->reserve(count);
+        for (std::size_t i = 0; i < count; ++i){
+            this->emplace_back();
+        }
+    }
+
+    template<typename T, std::size_t N, typename Allocator, typename Growth>
+    SmallVector<T, N, Allocator, Growth>::SmallVector(std::initializer_list<T> elements, const Allocator &alloc)
+        :SmallVector{alloc} {
+        this->reserve(elements.size());
+        for (auto &element : elements){
+            this->emplace_back(element);
+        }
+    }
+
+    template<typename T, std::size_t N, typename Allocator, typename Growth>
+    SmallVector<T, N, Allocator, Growth>::SmallVector(const SmallVector &other)
+        :SmallVector{std::allocator_traits<Allocator>::select_on_container_copy_construction(other.get_allocator())} {
+        this->reserve(other.size());
+        for (const auto &element : other){
+            this->emplace_back(element);
+        }
+    }
+
+    template<typename T, std::size_t N, typename Allocator, typename Growth>
+    SmallVector<T, N, Allocator, Growth>::SmallVector(SmallVector &&other)
+        noexcept(std::is_nothrow_move_constructible<T>::value) :SmallVector{other.get_allocator()} {
+        this->steal(other);
+    }
+
+    // copies into the storage already held, no temporary Vector
+    template<typename T, std::size_t N, typename Allocator, typename Growth>
+    SmallVector<T, N, Allocator, Growth> &SmallVector<T, N, Allocator, Growth>::operator=(const SmallVector &other) {
+        if (this != &other){
+            this->assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    // inline elements of other are moved one by one
+    template<typename T, std::size_t N, typename Allocator, typename Growth>
+    SmallVector<T, N, Allocator, Growth> &SmallVector<T, N, Allocator, Growth>::operator=(SmallVector &&other)
+        noexcept(std::is_nothrow_move_constructible<T>::value && base::adopts_moved_storage) {
+        this->move_assign(other);
+        return *this;
+    }
+
+    //-----------------  Capacity ------------------//
+    template<typename T, std::size_t N, typename Allocator, typename Growth>
+    bool SmallVector<T, N, Allocator, Growth>::is_small() const noexcept {
+        return this->is_inline(this->data());
+    }
+
+} // namespace container
@@ -0,0 +1,895 @@
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+#include <initializer_list>
+#include <sstream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "Growth_policy.hpp"
+#include "Simd.hpp"
+
+namespace container {
+
+    // Contiguous elements owned by a container, here a column of a SoaVector.
+    // Valid until the container reallocates.
+    template<typename T>
+    class Span {
+    public:
+        using value_type = std::remove_cv_t<T>;
+
+        Span() noexcept :m_data{nullptr}, m_size{0} {}
+        Span(T *data, std::size_t size) noexcept :m_data{data}, m_size{size} {}
+
+        T *data() const noexcept { return m_data; }
+        std::size_t size() const noexcept { return m_size; }
+        bool empty() const noexcept { return m_size == 0; }
+        T &operator[](std::size_t index) const { return m_data[index]; }
+        T *begin() const noexcept { return m_data; }
+        T *end() const noexcept { return m_data + m_size; }
+
+    private: // members
+        T *m_data;
+        std::size_t m_size;
+    };
+
+    // Sequence of records stored field by field: every field has its own
+    // contiguous array, so a loop over one field reads only that field's
+    // bytes. Rows are added and removed as in a Vector; a row is reached
+    // through a proxy, a tuple of references to its fields.
+    template<typename... Fields>
+    class SoaVector {
+        static_assert(sizeof...(Fields) > 0, "SoaVector needs at least one field");
+        using Columns = std::tuple<Fields*...>;
+        using indices = std::index_sequence_for<Fields...>;
+
+    public:
+        using value_type = std::tuple<Fields...>;
+        template<std::size_t I>
+        using field_type = std::tuple_element_t<I, value_type>;
+        class reference;
+        using const_reference = std::tuple<const Fields&...>;
+
+        // Constructors and destructor
+        SoaVector();
+        SoaVector(std::initializer_list<value_type> rows);
+        SoaVector(const SoaVector &other); // copy constructor
+        SoaVector(SoaVector &&other) noexcept; // move constructor
+        virtual ~SoaVector();
+        SoaVector &operator=(const SoaVector &other); // applies copy and swap idiom
+        SoaVector &operator=(SoaVector &&other) noexcept;
+
+        // Element access
+        reference at(std::size_t index);
+        const_reference at(std::size_t index) const;
+        reference operator[](std::size_t index);
+        const_reference operator[](std::size_t index) const;
+        reference front();
+        const_reference front() const;
+        reference back();
+        const_reference back() const;
+
+        // Columns, one array per field
+        template<std::size_t I>
+        Span<field_type<I>> column() noexcept;
+        template<std::size_t I>
+        Span<const field_type<I>> column() const noexcept;
+
+        // Inner classes
+        class const_iterator;
+        class iterator;
+
+        // Iterators
+        iterator begin() noexcept;
+        const_iterator begin() const noexcept;
+        const_iterator cbegin() const noexcept;
+        iterator end() noexcept;
+        const_iterator end() const noexcept;
+        const_iterator cend() const noexcept;
+
+        // Capacity
+        bool empty() const noexcept;
+        void reserve(std::size_t new_cap);
+        std::size_t size() const noexcept;
+        std::size_t capacity() const noexcept;
+
+        // Modifiers
+        template<class... Args>
+        reference emplace_back(Args&&... args); // one argument per field
+        void push_back(const value_type &row);
+        void push_back(value_type &&row);
+        iterator insert(const_iterator pos, const value_type &row);
+        iterator insert(const_iterator pos, value_type &&row);
+        iterator insert(std::size_t pos, const value_type &row);
+        iterator erase(const_iterator pos);
+        iterator erase(std::size_t pos);
+        void pop_back();
+        void clear() noexcept;
+        void swap(SoaVector &other) noexcept;
+
+        //Operations
+        std::string toString(const std::string &name = "") const;
+        bool operator==(const SoaVector &other) const;
+        bool operator!=(const SoaVector &other) const;
+
+    private:
+        template<class Fn, std::size_t... I>
+        static void for_each_field(Fn &&fn, std::index_sequence<I...>);
+        template<std::size_t... I>
+        reference row(std::size_t index, std::index_sequence<I...>);
+        template<std::size_t... I>
+        const_reference row(std::size_t index, std::index_sequence<I...>) const;
+        static Columns allocate(std::size_t count);
+        static void deallocate(Columns &columns, std::size_t count) noexcept;
+        static void destroy(Columns &columns, std::size_t first, std::size_t last) noexcept;
+        template<class... Args>
+        static void construct_row(Columns &columns, std::size_t index, Args&&... args);
+        template<bool Copy>
+        static void transfer(const Columns &from, std::size_t count, Columns &to);
+        void adopt(Columns &columns, std::size_t new_cap) noexcept;
+        template<class Row, std::size_t... I>
+        iterator insert_row(std::size_t pos, Row &&row, std::index_sequence<I...>);
+
+    private: // members
+        std::size_t m_size;
+        std::size_t m_capacity;
+        Columns m_columns;
+    };
+
+//-------------- Class SoaVector Implementation ------------//
+    //------ Constructors, destructor ----------//
+    template<typename... Fields>
+    SoaVector<Fields...>::SoaVector() :m_size{0}, m_capacity{0}, m_columns{} {}
+
+    template<typename... Fields>
+    SoaVector<Fields...>::SoaVector(std::initializer_list<value_type> rows) :SoaVector{} {
+        reserve(rows.size());
+        for (const auto &row : rows){
+            push_back(row);
+        }
+    }
+
+    template<typename... Fields>
+    SoaVector<Fields...>::SoaVector(const SoaVector &other) :SoaVector{} {
+        reserve(other.m_size);
+        transfer<true>(other.m_columns, other.m_size, m_columns);
+        m_size = other.m_size;
+    }
+
+    template<typename... Fields>
+    SoaVector<Fields...>::SoaVector(SoaVector &&other) noexcept :SoaVector{} {
+        swap(other);
+    }
+
+    template<typename... Fields>
+    SoaVector<Fields...>::~SoaVector(){
+        clear();
+        deallocate(m_columns, m_capacity);
+    }
+
+    // applying copy-and-swap idiom
+    template<typename... Fields>
+    SoaVector<Fields...> &SoaVector<Fields...>::operator=(const SoaVector &other) {
+        if (this != &other){
+            SoaVector temp{other};
+            swap(temp);
+        }
+        return *this;
+    }
+
+    template<typename... Fields>
+    SoaVector<Fields...> &SoaVector<Fields...>::operator=(SoaVector &&other) noexcept {
+        if (this != &other){
+            SoaVector temp{std::move(other)};
+            swap(temp);
+        }
+        return *this;
+    }
+
+    //--------------- Element access ---------------//
+    template<typename... Fields>
+    typename SoaVector<Fields...>::reference SoaVector<Fields...>::at(std::size_t index){
+        if (index >= m_size){
+            throw std::out_of_range("ERROR: Index out of bounds in SoaVector");
+        }
+        return row(index, indices{});
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_reference SoaVector<Fields...>::at(std::size_t index) const {
+        if (index >= m_size){
+            throw std::out_of_range("ERROR: Index out of bounds in SoaVector");
+        }
+        return row(index, indices{});
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::reference SoaVector<Fields...>::operator[](std::size_t index){
+        return row(index, indices{});
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_reference SoaVector<Fields...>::operator[](std::size_t index) const {
+        return row(index, indices{});
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::reference SoaVector<Fields...>::front(){
+        return row(0, indices{});
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_reference SoaVector<Fields...>::front() const {
+        return row(0, indices{});
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::reference SoaVector<Fields...>::back(){
+        return row(m_size - 1, indices{});
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_reference SoaVector<Fields...>::back() const {
+        return row(m_size - 1, indices{});
+    }
+
+    //----------------- Columns ------------------//
+    template<typename... Fields>
+    template<std::size_t I>
+    Span<typename SoaVector<Fields...>::template field_type<I>> SoaVector<Fields...>::column() noexcept {
+        return {std::get<I>(m_columns), m_size};
+    }
+
+    template<typename... Fields>
+    template<std::size_t I>
+    Span<const typename SoaVector<Fields...>::template field_type<I>> SoaVector<Fields...>::column() const noexcept {
+        return {std::get<I>(m_columns), m_size};
+    }
+
+    //-----------------  Iterators -----------------//
+    template<typename... Fields>
+    typename SoaVector<Fields...>::iterator SoaVector<Fields...>::begin() noexcept {
+        return iterator(this, 0);
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_iterator SoaVector<Fields...>::begin() const noexcept {
+        return cbegin();
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_iterator SoaVector<Fields...>::cbegin() const noexcept {
+        return const_iterator(const_cast<SoaVector *>(this), 0);
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::iterator SoaVector<Fields...>::end() noexcept {
+        return iterator(this, m_size);
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_iterator SoaVector<Fields...>::end() const noexcept {
+        return cend();
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_iterator SoaVector<Fields...>::cend() const noexcept {
+        return const_iterator(const_cast<SoaVector *>(this), m_size);
+    }
+
+    //----------------- Capacity ------------------//
+    template<typename... Fields>
+    bool SoaVector<Fields...>::empty() const noexcept {
+        return m_size == 0;
+    }
+
+    template<typename... Fields>
+    void SoaVector<Fields...>::reserve(std::size_t new_cap){
+        if (new_cap > m_capacity){
+            Columns columns = allocate(new_cap);
+            try {
+                transfer<false>(m_columns, m_size, columns);
+            } catch (...) {
+                deallocate(columns, new_cap);
+                throw;
+            }
+            adopt(columns, new_cap);
+        }
+    }
+
+    template<typename... Fields>
+    std::size_t SoaVector<Fields...>::size() const noexcept {
+        return m_size;
+    }
+
+    template<typename... Fields>
+    std::size_t SoaVector<Fields...>::capacity() const noexcept {
+        return m_capacity;
+    }
+
+    //----------------- Modifiers -----------------//
+    // A full SoaVector builds the new row in the new columns before moving
+    // the old rows, so the arguments may refer to its own fields
+    template<typename... Fields>
+    template<class... Args>
+    typename SoaVector<Fields...>::reference SoaVector<Fields...>::emplace_back(Args&&... args){
+        static_assert(sizeof...(Args) == sizeof...(Fields), "emplace_back takes one argument per field");
+        if (m_size < m_capacity){
+            construct_row(m_columns, m_size, std::forward<Args>(args)...);
+        } else {
+            const std::size_t new_cap = Doubling_growth::next_capacity<value_type>(m_capacity, m_size + 1);
+            Columns columns = allocate(new_cap);
+            try {
+                construct_row(columns, m_size, std::forward<Args>(args)...);
+                try {
+                    transfer<false>(m_columns, m_size, columns);
+                } catch (...) {
+                    destroy(columns, m_size, m_size + 1);
+                    throw;
+                }
+            } catch (...) {
+                deallocate(columns, new_cap);
+                throw;
+            }
+            adopt(columns, new_cap);
+        }
+        ++m_size;
+        return back();
+    }
+
+    template<typename... Fields>
+    void SoaVector<Fields...>::push_back(const value_type &row){
+        std::apply([this](const Fields&... fields){ emplace_back(fields...); }, row);
+    }
+
+    template<typename... Fields>
+    void SoaVector<Fields...>::push_back(value_type &&row){
+        std::apply([this](Fields&... fields){ emplace_back(std::move(fields)...); }, row);
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::iterator SoaVector<Fields...>::insert(const_iterator pos, const value_type &row){
+        return insert_row(pos.m_index, row, indices{});
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::iterator SoaVector<Fields...>::insert(const_iterator pos, value_type &&row){
+        return insert_row(pos.m_index, std::move(row), indices{});
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::iterator SoaVector<Fields...>::insert(std::size_t pos, const value_type &row){
+        if (pos > m_size){
+            throw std::out_of_range("ERROR: Index out of bounds in SoaVector");
+        }
+        return insert_row(pos, row, indices{});
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::iterator SoaVector<Fields...>::erase(const_iterator pos){
+        const std::size_t index = pos.m_index;
+        for_each_field([&](auto field){
+            auto *column = std::get<decltype(field)::value>(m_columns);
+            std::move(column + index + 1, column + m_size, column + index);
+        }, indices{});
+        pop_back();
+        return iterator(this, index);
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::iterator SoaVector<Fields...>::erase(std::size_t pos){
+        if (pos >= m_size){
+            throw std::out_of_range("ERROR: Index out of bounds in SoaVector");
+        }
+        return erase(cbegin() + static_cast<std::ptrdiff_t>(pos));
+    }
+
+    template<typename... Fields>
+    void SoaVector<Fields...>::pop_back(){
+        destroy(m_columns, m_size - 1, m_size);
+        --m_size;
+    }
+
+    // keeps the capacity, as Vector::clear does not
+    template<typename... Fields>
+    void SoaVector<Fields...>::clear() noexcept {
+        destroy(m_columns, 0, m_size);
+        m_size = 0;
+    }
+
+    template<typename... Fields>
+    void SoaVector<Fields...>::swap(SoaVector &other) noexcept {
+        std::swap(m_size, other.m_size);
+        std::swap(m_capacity, other.m_capacity);
+        std::swap(m_columns, other.m_columns);
+    }
+
+    //------------------- Operations -----------------------//
+    namespace detail {
+        // (field, field, ...)
+        template<typename Row, std::size_t... I>
+        void print_row(std::ostream &os, const Row &row, std::index_sequence<I...>) {
+            os << '(';
+            ((os << (I == 0 ? "" : ", ") << std::get<I>(row)), ...);
+            os << ')';
+        }
+    } // namespace detail
+
+    template<typename... Fields>
+    std::string SoaVector<Fields...>::toString(const std::string &name) const {
+        std::stringstream stream;
+        stream << "\n<===== SoaVector: " << name << " ======>\n >>Size:" << m_size;
+        for (std::size_t index = 0; index < m_size; ++index) {
+            stream << "\n [" << index << "]=> ";
+            detail::print_row(stream, (*this)[index], indices{});
+        }
+        stream << "\n<=== End " << name << " ====>\n";
+        return stream.str();
+    }
+
+    // compares column by column
+    template<typename... Fields>
+    bool SoaVector<Fields...>::operator==(const SoaVector &other) const {
+        if (m_size != other.m_size){
+            return false;
+        }
+        bool equal = true;
+        for_each_field([&](auto field){
+            constexpr std::size_t I = decltype(field)::value;
+            const auto *column = std::get<I>(m_columns);
+            equal = equal && simd::equal(column, column + m_size, static_cast<const field_type<I> *>(std::get<I>(other.m_columns)));
+        }, indices{});
+        return equal;
+    }
+
+    template<typename... Fields>
+    bool SoaVector<Fields...>::operator!=(const SoaVector &other) const {
+        return !(operator==(other));
+    }
+
+    //---------------- Private member functions ----------------//
+    // private member function, fn(std::integral_constant<std::size_t, I>) for every field I
+    template<typename... Fields>
+    template<class Fn, std::size_t... I>
+    void SoaVector<Fields...>::for_each_field(Fn &&fn, std::index_sequence<I...>){
+        (fn(std::integral_constant<std::size_t, I>{}), ...);
+    }
+
+    // private member function
+    template<typename... Fields>
+    template<std::size_t... I>
+    typename SoaVector<Fields...>::reference SoaVector<Fields...>::row(std::size_t index, std::index_sequence<I...>){
+        return reference(std::get<I>(m_columns)[index]...);
+    }
+
+    // private member function
+    template<typename... Fields>
+    template<std::size_t... I>
+    typename SoaVector<Fields...>::const_reference SoaVector<Fields...>::row(std::size_t index, std::index_sequence<I...>) const {
+        return const_reference(std::get<I>(m_columns)[index]...);
+    }
+
+    // private member function, raw storage for count rows in every column
+    template<typename... Fields>
+    typename SoaVector<Fields...>::Columns SoaVector<Fields...>::allocate(std::size_t count){
+        Columns columns{};
+        if (count == 0){
+            return columns;
+        }
+        try {
+            for_each_field([&](auto field){
+                constexpr std::size_t I = decltype(field)::value;
+                std::allocator<field_type<I>> alloc;
+                std::get<I>(columns) = alloc.allocate(count);
+            }, indices{});
+        } catch (...) {
+            deallocate(columns, count);
+            throw;
+        }
+        return columns;
+    }
+
+    // private member function, null columns are skipped
+    template<typename... Fields>
+    void SoaVector<Fields...>::deallocate(Columns &columns, std::size_t count) noexcept {
+        for_each_field([&](auto field){
+            constexpr std::size_t I = decltype(field)::value;
+            if (std::get<I>(columns)){
+                std::allocator<field_type<I>> alloc;
+                alloc.deallocate(std::get<I>(columns), count);
+                std::get<I>(columns) = nullptr;
+            }
+        }, indices{});
+    }
+
+    // private member function, destroys the rows [first, last)
+    template<typename... Fields>
+    void SoaVector<Fields...>::destroy(Columns &columns, std::size_t first, std::size_t last) noexcept {
+        for_each_field([&](auto field){
+            auto *column = std::get<decltype(field)::value>(columns);
+            std::destroy(column + first, column + last);
+        }, indices{});
+    }
+
+    // private member function, constructs every field of row `index` from its
+    // argument. A throwing field destroys the fields built before it.
+    template<typename... Fields>
+    template<class... Args>
+    void SoaVector<Fields...>::construct_row(Columns &columns, std::size_t index, Args&&... args){
+        std::size_t built = 0;
+        try {
+            std::apply([&](Fields*... column){
+                ((::new (static_cast<void *>(column + index)) Fields(std::forward<Args>(args)), ++built), ...);
+            }, columns);
+        } catch (...) {
+            for_each_field([&](auto field){
+                constexpr std::size_t I = decltype(field)::value;
+                if (I < built){
+                    std::destroy_at(std::get<I>(columns) + index);
+                }
+            }, indices{});
+            throw;
+        }
+    }
+
+    // private member function, constructs the first count rows of `to` from
+    // those of `from`: copies, or moves for the fields whose move cannot throw
+    // unless Copy is set. All or none of the rows are built; `from` is left
+    // to the caller.
+    template<typename... Fields>
+    template<bool Copy>
+    void SoaVector<Fields...>::transfer(const Columns &from, std::size_t count, Columns &to){
+        std::size_t done = 0;
+        try {
+            for_each_field([&](auto field){
+                constexpr std::size_t I = decltype(field)::value;
+                using T = field_type<I>;
+                T *source = std::get<I>(from);
+                if constexpr (!Copy && (std::is_nothrow_move_constructible<T>::value || !std::is_copy_constructible<T>::value)){
+                    std::uninitialized_move_n(source, count, std::get<I>(to));
+                } else {
+                    std::uninitialized_copy_n(source, count, std::get<I>(to));
+                }
+                ++done;
+            }, indices{});
+        } catch (...) {
+            for_each_field([&](auto field){
+                constexpr std::size_t I = decltype(field)::value;
+                if (I < done){
+                    std::destroy_n(std::get<I>(to), count);
+                }
+            }, indices{});
+            throw;
+        }
+    }
+
+    // private member function, replaces the columns by ones already holding the rows
+    template<typename... Fields>
+    void SoaVector<Fields...>::adopt(Columns &columns, std::size_t new_cap) noexcept {
+        destroy(m_columns, 0, m_size);
+        deallocate(m_columns, m_capacity);
+        m_columns = columns;
+        m_capacity = new_cap;
+    }
+
+    // private member function, the last row moves one place up, the others
+    // are shifted by move assignment and the new row is assigned at pos
+    template<typename... Fields>
+    template<class Row, std::size_t... I>
+    typename SoaVector<Fields...>::iterator SoaVector<Fields...>::insert_row(std::size_t pos, Row &&row, std::index_sequence<I...>){
+        if (pos == m_size){
+            emplace_back(std::get<I>(std::forward<Row>(row))...);
+            return iterator(this, pos);
+        }
+        if (m_size == m_capacity){
+            reserve(Doubling_growth::next_capacity<value_type>(m_capacity, m_size + 1));
+        }
+        construct_row(m_columns, m_size, std::move(std::get<I>(m_columns)[m_size - 1])...);
+        ++m_size;
+        for_each_field([&](auto field){
+            constexpr std::size_t J = decltype(field)::value;
+            auto *column = std::get<J>(m_columns);
+            std::move_backward(column + pos, column + m_size - 2, column + m_size - 1);
+            column[pos] = std::get<J>(std::forward<Row>(row));
+        }, indices{});
+        return iterator(this, pos);
+    }
+
+    //---------------- Non-member functions ----------------//
+    template<typename... Fields>
+    std::ostream& operator<<(std::ostream& os, const SoaVector<Fields...> &vector) {
+        for (std::size_t i = 0; i < vector.size(); ++i) {
+            detail::print_row(os, vector[i], std::index_sequence_for<Fields...>{});
+            os << ", ";
+        }
+        os << "END";
+        return os;
+    }
+
+    //-------------- Inner class reference --------//
+    // Proxy for one row: a tuple of references to its fields, so std::get<I>
+    // reads and writes a field. Assigning a row or another proxy assigns the
+    // fields, and swap exchanges them, which lets std::sort reorder rows.
+    template<typename... Fields>
+    class SoaVector<Fields...>::reference : public std::tuple<Fields&...> {
+        using base = std::tuple<Fields&...>;
+
+    public:
+        explicit reference(Fields&... fields) :base(fields...) {}
+        reference(const reference &other) = default;
+
+        reference &operator=(const reference &other) {
+            base::operator=(static_cast<const base &>(other));
+            return *this;
+        }
+
+        reference &operator=(const value_type &row) {
+            base::operator=(row);
+            return *this;
+        }
+
+        reference &operator=(value_type &&row) {
+            base::operator=(std::move(row));
+            return *this;
+        }
+
+        friend void swap(reference a, reference b) {
+            a.swap_fields(b, indices{});
+        }
+
+    private:
+        template<std::size_t... I>
+        void swap_fields(reference &other, std::index_sequence<I...>) {
+            using std::swap;
+            (swap(std::get<I>(static_cast<base &>(*this)), std::get<I>(static_cast<base &>(other))), ...);
+        }
+    };
+
+    //-------------- Inner class const_iterator --------//
+    // Random-access iterator over the rows. It yields proxies rather than
+    // references, as std::vector<bool>'s iterator does.
+    template<typename... Fields>
+    class SoaVector<Fields...>::const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = typename SoaVector::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = typename SoaVector::const_reference;
+
+        const_iterator();
+
+        reference operator*() const;
+        reference operator[](difference_type offset) const;
+
+        const_iterator &operator++(); // Prefix
+        const_iterator operator++(int); // Postfix
+        const_iterator &operator--(); // Prefix
+        const_iterator operator--(int); // Postfix
+        const_iterator &operator+=(difference_type offset);
+        const_iterator &operator-=(difference_type offset);
+        const_iterator operator+(difference_type offset) const;
+        const_iterator operator-(difference_type offset) const;
+        friend const_iterator operator+(difference_type offset, const const_iterator &it) { return it + offset; }
+
+        bool operator==(const const_iterator &other) const;
+        bool operator!=(const const_iterator &other) const;
+        bool operator<(const const_iterator &other) const;
+        bool operator>(const const_iterator &other) const;
+        bool operator<=(const const_iterator &other) const;
+        bool operator>=(const const_iterator &other) const;
+        difference_type operator-(const const_iterator &other) const;
+
+    protected:
+        SoaVector *m_owner; // members
+        std::size_t m_index;
+
+        const_iterator(SoaVector *owner, std::size_t index); // constructor
+        friend class SoaVector<Fields...>;
+    };
+
+    //------------------- Inner class iterator ------------------//
+    template<typename... Fields>
+    class SoaVector<Fields...>::iterator final : public const_iterator {
+    public:
+        using typename const_iterator::difference_type;
+        using reference = typename SoaVector::reference;
+
+        iterator();
+
+        reference operator*() const;
+        reference operator[](difference_type offset) const;
+
+        iterator &operator++();
+        iterator operator++(int);
+        iterator &operator--();
+        iterator operator--(int);
+        iterator &operator+=(difference_type offset);
+        iterator &operator-=(difference_type offset);
+        iterator operator+(difference_type offset) const;
+        iterator operator-(difference_type offset) const;
+        using const_iterator::operator-; // distance between iterators
+        friend iterator operator+(difference_type offset, const iterator &it) { return it + offset; }
+
+    private:
+        iterator(SoaVector *owner, std::size_t index); // constructor
+        friend class SoaVector<Fields...>;
+    };
+
+    //-------------- class const_iterator implementation--------//
+    template<typename... Fields>
+    SoaVector<Fields...>::const_iterator::const_iterator() :m_owner{nullptr}, m_index{0} {}
+
+    //protected constructor
+    template<typename... Fields>
+    SoaVector<Fields...>::const_iterator::const_iterator(SoaVector *owner, std::size_t index)
+        :m_owner{owner}, m_index{index} {}
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_reference SoaVector<Fields...>::const_iterator::operator*() const {
+        return static_cast<const SoaVector &>(*m_owner)[m_index];
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_reference SoaVector<Fields...>::const_iterator::operator[](difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_iterator &SoaVector<Fields...>::const_iterator::operator++(){
+        ++m_index;
+        return *this;
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_iterator SoaVector<Fields...>::const_iterator::operator++(int){
+        const_iterator temp = *this;
+        ++m_index;
+        return temp;
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_iterator &SoaVector<Fields...>::const_iterator::operator--(){
+        --m_index;
+        return *this;
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_iterator SoaVector<Fields...>::const_iterator::operator--(int){
+        const_iterator temp = *this;
+        --m_index;
+        return temp;
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_iterator &SoaVector<Fields...>::const_iterator::operator+=(difference_type offset){
+        m_index += static_cast<std::size_t>(offset);
+        return *this;
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_iterator &SoaVector<Fields...>::const_iterator::operator-=(difference_type offset){
+        m_index -= static_cast<std::size_t>(offset);
+        return *this;
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_iterator SoaVector<Fields...>::const_iterator::operator+(difference_type offset) const {
+        const_iterator temp = *this;
+        return temp += offset;
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_iterator SoaVector<Fields...>::const_iterator::operator-(difference_type offset) const {
+        const_iterator temp = *this;
+        return temp -= offset;
+    }
+
+    template<typename... Fields>
+    bool SoaVector<Fields...>::const_iterator::operator==(const const_iterator &other) const {
+        return m_index == other.m_index && m_owner == other.m_owner;
+    }
+
+    template<typename... Fields>
+    bool SoaVector<Fields...>::const_iterator::operator!=(const const_iterator &other) const {
+        return !(*this == other);
+    }
+
+    template<typename... Fields>
+    bool SoaVector<Fields...>::const_iterator::operator<(const const_iterator &other) const {
+        return m_index < other.m_index;
+    }
+
+    template<typename... Fields>
+    bool SoaVector<Fields...>::const_iterator::operator>(const const_iterator &other) const {
+        return other < *this;
+    }
+
+    template<typename... Fields>
+    bool SoaVector<Fields...>::const_iterator::operator<=(const const_iterator &other) const {
+        return !(other < *this);
+    }
+
+    template<typename... Fields>
+    bool SoaVector<Fields...>::const_iterator::operator>=(const const_iterator &other) const {
+        return !(*this < other);
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::const_iterator::difference_type SoaVector<Fields...>::const_iterator::operator-(const const_iterator &other) const {
+        return static_cast<difference_type>(m_index) - static_cast<difference_type>(other.m_index);
+    }
+
+    //-------------- class iterator implementation--------//
+    template<typename... Fields>
+    SoaVector<Fields...>::iterator::iterator() :const_iterator() {}
+
+    //private constructor
+    template<typename... Fields>
+    SoaVector<Fields...>::iterator::iterator(SoaVector *owner, std::size_t index) :const_iterator(owner, index) {}
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::reference SoaVector<Fields...>::iterator::operator*() const {
+        return (*this->m_owner)[this->m_index];
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::reference SoaVector<Fields...>::iterator::operator[](difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::iterator &SoaVector<Fields...>::iterator::operator++(){
+        ++this->m_index;
+        return *this;
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::iterator SoaVector<Fields...>::iterator::operator++(int){
+        iterator temp = *this;
+        ++this->m_index;
+        return temp;
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::iterator &SoaVector<Fields...>::iterator::operator--(){
+        --this->m_index;
+        return *this;
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::iterator SoaVector<Fields...>::iterator::operator--(int){
+        iterator temp = *this;
+        --this->m_index;
+        return temp;
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::iterator &SoaVector<Fields...>::iterator::operator+=(difference_type offset){
+        this->m_index += static_cast<std::size_t>(offset);
+        return *this;
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::iterator &SoaVector<Fields...>::iterator::operator-=(difference_type offset){
+        this->m_index -= static_cast<std::size_t>(offset);
+        return *this;
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::iterator SoaVector<Fields...>::iterator::operator+(difference_type offset) const {
+        iterator temp = *this;
+        return temp += offset;
+    }
+
+    template<typename... Fields>
+    typename SoaVector<Fields...>::iterator SoaVector<Fields...>::iterator::operator-(difference_type offset) const {
+        iterator temp = *this;
+        return temp -= offset;
+    }
+
+} // namespace container
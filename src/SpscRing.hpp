@@ -0,0 +1,351 @@
+#pragma once
+
+#include <atomic>
+#include <stdexcept>
+#include <sstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+
+namespace container {
+
+    // Size of the blocks the caches move between cores. A constant rather than
+    // std::hardware_destructive_interference_size, whose value may change
+    // between compiler versions.
+    constexpr std::size_t cache_line_size = 64;
+
+    // Bounded wait-free queue for one producer thread and one consumer thread.
+    // The capacity is rounded up to a power of two. Each side owns a cache line
+    // holding its index and its last seen copy of the other side's index, so a
+    // push or pop reads the other line only when the copy says the ring looks
+    // full or empty.
+    template<typename T, typename Allocator = std::allocator<T>>
+    class SpscRing {
+        using alloc_traits = std::allocator_traits<Allocator>;
+
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+
+        // Constructors and destructor
+        explicit SpscRing(std::size_t capacity, const Allocator &alloc = Allocator());
+        SpscRing(const SpscRing &other) = delete; // the indices are shared between threads
+        SpscRing &operator=(const SpscRing &other) = delete;
+        virtual ~SpscRing();
+        allocator_type get_allocator() const;
+
+        // Inner class
+        class const_iterator;
+
+        // Iterators, only while neither thread modifies the ring or from the consumer thread
+        const_iterator begin() const noexcept;
+        const_iterator cbegin() const noexcept;
+        const_iterator end() const noexcept;
+        const_iterator cend() const noexcept;
+
+        // Capacity
+        bool empty() const noexcept;
+        std::size_t size() const noexcept; // exact only when called from the producer or consumer thread
+        std::size_t capacity() const noexcept;
+
+        // Producer side
+        template<class... Args>
+        bool try_emplace(Args&&... args);
+        bool try_push(const T &value);
+        bool try_push(T &&value);
+        template<class InputIt>
+        std::size_t push_n(InputIt first, std::size_t count);
+
+        // Consumer side
+        bool try_pop(T &value);
+        template<class OutputIt>
+        std::size_t pop_n(OutputIt out, std::size_t count);
+
+        //Operations
+        std::string toString(const std::string &name = "") const;
+
+    private:
+        static std::size_t round_capacity(std::size_t capacity);
+
+    private: // members
+        // written by the producer
+        alignas(cache_line_size) std::atomic<std::size_t> m_tail;
+        std::size_t m_head_cache;
+        // written by the consumer
+        alignas(cache_line_size) std::atomic<std::size_t> m_head;
+        std::size_t m_tail_cache;
+        // read only after construction
+        alignas(cache_line_size) T *m_data;
+        std::size_t m_mask;
+        Allocator m_alloc;
+    };
+
+//-------------- Class SpscRing Implementation ------------//
+    //------ Constructors, destructor ----------//
+    template<typename T, typename Allocator>
+    SpscRing<T, Allocator>::SpscRing(std::size_t capacity, const Allocator &alloc)
+        :m_tail{0}, m_head_cache{0}, m_head{0}, m_tail_cache{0}, m_data{nullptr},
+         m_mask{round_capacity(capacity) - 1}, m_alloc{alloc} {
+        m_data = alloc_traits::allocate(m_alloc, m_mask + 1);
+    }
+
+    template<typename T, typename Allocator>
+    SpscRing<T, Allocator>::~SpscRing(){
+        const std::size_t tail = m_tail.load(std::memory_order_acquire);
+        for (std::size_t head = m_head.load(std::memory_order_relaxed); head != tail; ++head){
+            alloc_traits::destroy(m_alloc, m_data + (head & m_mask));
+        }
+        alloc_traits::deallocate(m_alloc, m_data, m_mask + 1);
+    }
+
+    template<typename T, typename Allocator>
+    typename SpscRing<T, Allocator>::allocator_type SpscRing<T, Allocator>::get_allocator() const {
+        return m_alloc;
+    }
+
+    // private member function
+    template<typename T, typename Allocator>
+    std::size_t SpscRing<T, Allocator>::round_capacity(std::size_t capacity) {
+        if (capacity == 0){
+            throw std::runtime_error("ERROR: SpscRing needs a positive capacity");
+        }
+        std::size_t rounded = 2;
+        while (rounded < capacity){
+            if (rounded > std::numeric_limits<std::size_t>::max() / 2){
+                throw std::length_error("ERROR: SpscRing capacity is too large");
+            }
+            rounded *= 2;
+        }
+        return rounded;
+    }
+
+    //---------------- Iterators ------------------//
+    template<typename T, typename Allocator>
+    typename SpscRing<T, Allocator>::const_iterator SpscRing<T, Allocator>::begin() const noexcept {
+        return cbegin();
+    }
+
+    template<typename T, typename Allocator>
+    typename SpscRing<T, Allocator>::const_iterator SpscRing<T, Allocator>::cbegin() const noexcept {
+        return const_iterator{this, m_head.load(std::memory_order_relaxed)};
+    }
+
+    template<typename T, typename Allocator>
+    typename SpscRing<T, Allocator>::const_iterator SpscRing<T, Allocator>::end() const noexcept {
+        return cend();
+    }
+
+    template<typename T, typename Allocator>
+    typename SpscRing<T, Allocator>::const_iterator SpscRing<T, Allocator>::cend() const noexcept {
+        return const_iterator{this, m_tail.load(std::memory_order_acquire)};
+    }
+
+    //----------------- Capacity ------------------//
+    template<typename T, typename Allocator>
+    bool SpscRing<T, Allocator>::empty() const noexcept {
+        return size() == 0;
+    }
+
+    // the head is read first, so the tail read after it is never behind it
+    template<typename T, typename Allocator>
+    std::size_t SpscRing<T, Allocator>::size() const noexcept {
+        const std::size_t head = m_head.load(std::memory_order_acquire);
+        const std::size_t tail = m_tail.load(std::memory_order_acquire);
+        const std::size_t count = tail - head;
+        return count > m_mask + 1 ? m_mask + 1 : count;
+    }
+
+    template<typename T, typename Allocator>
+    std::size_t SpscRing<T, Allocator>::capacity() const noexcept {
+        return m_mask + 1;
+    }
+
+    //----------------- Producer side -----------------//
+    template<typename T, typename Allocator>
+    template<class... Args>
+    bool SpscRing<T, Allocator>::try_emplace(Args&&... args){
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head_cache > m_mask){
+            m_head_cache = m_head.load(std::memory_order_acquire);
+            if (tail - m_head_cache > m_mask){
+                return false;
+            }
+        }
+        alloc_traits::construct(m_alloc, m_data + (tail & m_mask), std::forward<Args>(args)...);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename T, typename Allocator>
+    bool SpscRing<T, Allocator>::try_push(const T &value){
+        return try_emplace(value);
+    }
+
+    template<typename T, typename Allocator>
+    bool SpscRing<T, Allocator>::try_push(T &&value){
+        return try_emplace(std::move(value));
+    }
+
+    // copies as many of the count elements as fit and publishes them at once,
+    // returns the number copied
+    template<typename T, typename Allocator>
+    template<class InputIt>
+    std::size_t SpscRing<T, Allocator>::push_n(InputIt first, std::size_t count){
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (m_mask + 1 - (tail - m_head_cache) < count){
+            m_head_cache = m_head.load(std::memory_order_acquire);
+        }
+        const std::size_t space = m_mask + 1 - (tail - m_head_cache);
+        const std::size_t pushed = count < space ? count : space;
+        std::size_t done = 0;
+        try {
+            for (; done < pushed; ++done, ++first){
+                alloc_traits::construct(m_alloc, m_data + ((tail + done) & m_mask), *first);
+            }
+        } catch (...) {
+            m_tail.store(tail + done, std::memory_order_release);
+            throw;
+        }
+        m_tail.store(tail + pushed, std::memory_order_release);
+        return pushed;
+    }
+
+    //----------------- Consumer side -----------------//
+    template<typename T, typename Allocator>
+    bool SpscRing<T, Allocator>::try_pop(T &value){
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail_cache){
+            m_tail_cache = m_tail.load(std::memory_order_acquire);
+            if (head == m_tail_cache){
+                return false;
+            }
+        }
+        T *element = m_data + (head & m_mask);
+        value = std::move(*element);
+        alloc_traits::destroy(m_alloc, element);
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // moves up to count elements to out and frees their slots at once,
+    // returns the number moved
+    template<typename T, typename Allocator>
+    template<class OutputIt>
+    std::size_t SpscRing<T, Allocator>::pop_n(OutputIt out, std::size_t count){
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (m_tail_cache - head < count){
+            m_tail_cache = m_tail.load(std::memory_order_acquire);
+        }
+        const std::size_t available = m_tail_cache - head;
+        const std::size_t popped = count < available ? count : available;
+        std::size_t done = 0;
+        try {
+            for (; done < popped; ++done, ++out){
+                T *element = m_data + ((head + done) & m_mask);
+                *out = std::move(*element);
+                alloc_traits::destroy(m_alloc, element);
+            }
+        } catch (...) {
+            m_head.store(head + done, std::memory_order_release);
+            throw;
+        }
+        m_head.store(head + popped, std::memory_order_release);
+        return popped;
+    }
+
+    //------------------- Operations -----------------------//
+    template<typename T, typename Allocator>
+    std::string SpscRing<T, Allocator>::toString(const std::string &name) const {
+        std::stringstream stream;
+        stream << "\n<===== SpscRing: " << name << " ======>\n >>Size:" << size();
+        std::size_t index = 0;
+        for (const auto &it : *this) {
+            stream << "\n [" << index << "]=> " << it ;
+            index++;
+        }
+        stream << "\n<=== End " << name << " ====>\n";
+        return stream.str();
+    }
+
+    //---------------- Non-member functions ----------------//
+    template<typename T, typename Allocator>
+    std::ostream& operator<<(std::ostream& os, const SpscRing<T, Allocator> & ring) {
+        for (const auto &it : ring) {
+            os << it << ", ";
+        }
+        os << "END";
+        return os;
+    }
+
+    //-------------- Inner class const_iterator --------//
+    // Forward iterator from the oldest to the newest element
+    template<typename T, typename Allocator>
+    class SpscRing<T, Allocator>::const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator();
+
+        const T &operator*() const;
+        const T *operator->() const;
+        const_iterator &operator++(); // Prefix
+        const_iterator operator++(int); // Postfix
+        bool operator==(const const_iterator &other) const;
+        bool operator!=(const const_iterator &other) const;
+
+    protected:
+        const SpscRing *m_ring; // members
+        std::size_t m_position;
+
+        const_iterator(const SpscRing *ring, std::size_t position); // constructor
+        friend class SpscRing<T, Allocator>;
+    };
+
+    //-------------- class const_iterator implementation--------//
+    template<typename T, typename Allocator>
+    SpscRing<T, Allocator>::const_iterator::const_iterator() :m_ring{nullptr}, m_position{0} {}
+
+    //protected constructor
+    template<typename T, typename Allocator>
+    SpscRing<T, Allocator>::const_iterator::const_iterator(const SpscRing *ring, std::size_t position)
+        :m_ring{ring}, m_position{position} {}
+
+    template<typename T, typename Allocator>
+    const T &SpscRing<T, Allocator>::const_iterator::operator*() const {
+        return m_ring->m_data[m_position & m_ring->m_mask];
+    }
+
+    template<typename T, typename Allocator>
+    const T *SpscRing<T, Allocator>::const_iterator::operator->() const {
+        return m_ring->m_data + (m_position & m_ring->m_mask);
+    }
+
+    template<typename T, typename Allocator>
+    typename SpscRing<T, Allocator>::const_iterator &SpscRing<T, Allocator>::const_iterator::operator++(){
+        ++m_position;
+        return *this;
+    }
+
+    template<typename T, typename Allocator>
+    typename SpscRing<T, Allocator>::const_iterator SpscRing<T, Allocator>::const_iterator::operator++(int){
+        const_iterator temp = *this;
+        ++m_position;
+        return temp;
+    }
+
+    template<typename T, typename Allocator>
+    bool SpscRing<T, Allocator>::const_iterator::operator==(const const_iterator &other) const {
+        return m_position == other.m_position && m_ring == other.m_ring;
+    }
+
+    template<typename T, typename Allocator>
+    bool SpscRing<T, Allocator>::const_iterator::operator!=(const const_iterator &other) const {
+        return !(*this == other);
+    }
+
+} // namespace container
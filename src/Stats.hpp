@@ -0,0 +1,315 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+
+// Operation counters of Vector, List and Forward_list. They are compiled in
+// only when CONTAINER_STATS is defined (-DCONTAINER_STATS); otherwise every
+// hook below is an empty inline function and the containers are unchanged.
+// Counters are kept per container type, e.g. all List<int> instances share
+// theirs. Each thread counts into its own copy, written by that thread alone
+// without locked instructions; a snapshot adds up the copies of all threads.
+
+namespace container {
+namespace stats {
+
+#if defined(CONTAINER_STATS)
+    constexpr bool enabled = true;
+#else
+    constexpr bool enabled = false;
+#endif
+
+    struct Snapshot {
+        std::uint64_t allocations = 0;      // blocks obtained from the allocator
+        std::uint64_t deallocations = 0;    // blocks given back
+        std::uint64_t bytes_allocated = 0;  // total size of the blocks obtained
+        std::uint64_t reallocations = 0;    // Vector storage replaced by a larger block
+        std::uint64_t moves = 0;            // elements move constructed or assigned, relocations included
+        std::uint64_t copies = 0;           // elements copy constructed or assigned
+        std::uint64_t seek_walks = 0;       // nodes stepped over to reach an index
+        std::size_t peak_size = 0;          // largest size reached by an instance
+        std::size_t peak_capacity = 0;      // largest Vector capacity allocated, in elements
+    };
+
+    namespace detail {
+        // a single argument of the element type is a copy or a move depending
+        // on its value category, anything else builds a new element
+        template<class T, class... Args>
+        struct is_copy : std::false_type {};
+
+        template<class T, class Arg>
+        struct is_copy<T, Arg> : std::integral_constant<bool,
+            std::is_same<std::remove_cv_t<std::remove_reference_t<Arg>>, T>::value &&
+            (std::is_lvalue_reference<Arg>::value || std::is_const<std::remove_reference_t<Arg>>::value)> {};
+
+        template<class T, class... Args>
+        struct is_move : std::false_type {};
+
+        template<class T, class Arg>
+        struct is_move<T, Arg> : std::integral_constant<bool,
+            std::is_same<std::remove_cv_t<std::remove_reference_t<Arg>>, T>::value && !is_copy<T, Arg>::value> {};
+    } // namespace detail
+
+    // Hooks the containers call, Container is the container type counted
+    template<class Container>
+    class Recorder {
+    public:
+        static void allocation(std::size_t bytes) noexcept;
+        static void deallocation() noexcept;
+        static void reallocation() noexcept;
+        static void moved(std::size_t count) noexcept;
+        static void copied(std::size_t count) noexcept;
+        template<class T, class... Args>
+        static void constructed(std::size_t count) noexcept; // count T built from Args
+        static void walked(std::size_t nodes) noexcept;
+        static void size(std::size_t size) noexcept;
+        static void capacity(std::size_t capacity) noexcept;
+
+        static Snapshot snapshot() noexcept;
+        static void reset() noexcept;
+
+#if defined(CONTAINER_STATS)
+    private:
+        enum Counter : std::size_t {
+            allocations, deallocations, bytes_allocated, reallocations, moves, copies, seek_walks,
+            peak_size, peak_capacity, counter_count
+        };
+
+        // counters of one thread, linked into the registry while the thread runs
+        struct Local {
+            Local();
+            ~Local();
+            std::atomic<std::uint64_t> values[counter_count]{};
+            Local *prev = nullptr;
+            Local *next = nullptr;
+        };
+
+        struct Registry {
+            std::mutex mutex;
+            Local *head = nullptr;
+            std::uint64_t retired[counter_count]{}; // counts of the threads that ended
+        };
+
+        static Registry &registry() noexcept;
+        static Local &local() noexcept;
+        static void add(Counter counter, std::uint64_t count) noexcept;
+        static void raise(Counter counter, std::uint64_t value) noexcept;
+        static bool is_peak(std::size_t counter) noexcept;
+#endif
+    };
+
+    // counters of every Container instance since the start or the last reset,
+    // all zero when CONTAINER_STATS is not defined
+    template<class Container>
+    Snapshot snapshot() noexcept {
+        return Recorder<Container>::snapshot();
+    }
+
+    template<class Container>
+    void reset() noexcept {
+        Recorder<Container>::reset();
+    }
+
+//-------------- Class Recorder Implementation ------------//
+#if defined(CONTAINER_STATS)
+    template<class Container>
+    void Recorder<Container>::allocation(std::size_t bytes) noexcept {
+        add(allocations, 1);
+        add(bytes_allocated, bytes);
+    }
+
+    template<class Container>
+    void Recorder<Container>::deallocation() noexcept {
+        add(deallocations, 1);
+    }
+
+    template<class Container>
+    void Recorder<Container>::reallocation() noexcept {
+        add(reallocations, 1);
+    }
+
+    template<class Container>
+    void Recorder<Container>::moved(std::size_t count) noexcept {
+        add(moves, count);
+    }
+
+    template<class Container>
+    void Recorder<Container>::copied(std::size_t count) noexcept {
+        add(copies, count);
+    }
+
+    template<class Container>
+    template<class T, class... Args>
+    void Recorder<Container>::constructed(std::size_t count) noexcept {
+        if constexpr (detail::is_copy<T, Args...>::value){
+            copied(count);
+        } else if constexpr (detail::is_move<T, Args...>::value){
+            moved(count);
+        }
+    }
+
+    template<class Container>
+    void Recorder<Container>::walked(std::size_t nodes) noexcept {
+        add(seek_walks, nodes);
+    }
+
+    template<class Container>
+    void Recorder<Container>::size(std::size_t size) noexcept {
+        raise(peak_size, size);
+    }
+
+    template<class Container>
+    void Recorder<Container>::capacity(std::size_t capacity) noexcept {
+        raise(peak_capacity, capacity);
+    }
+
+    // sums of the running and ended threads, maxima for the peaks
+    template<class Container>
+    Snapshot Recorder<Container>::snapshot() noexcept {
+        std::uint64_t values[counter_count];
+        {
+            Registry &shared = registry();
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            for (std::size_t i = 0; i < counter_count; ++i){
+                values[i] = shared.retired[i];
+            }
+            for (const Local *thread = shared.head; thread; thread = thread->next){
+                for (std::size_t i = 0; i < counter_count; ++i){
+                    std::uint64_t value = thread->values[i].load(std::memory_order_relaxed);
+                    values[i] = is_peak(i) ? (value > values[i] ? value : values[i]) : values[i] + value;
+                }
+            }
+        }
+        Snapshot result;
+        result.allocations = values[allocations];
+        result.deallocations = values[deallocations];
+        result.bytes_allocated = values[bytes_allocated];
+        result.reallocations = values[reallocations];
+        result.moves = values[moves];
+        result.copies = values[copies];
+        result.seek_walks = values[seek_walks];
+        result.peak_size = static_cast<std::size_t>(values[peak_size]);
+        result.peak_capacity = static_cast<std::size_t>(values[peak_capacity]);
+        return result;
+    }
+
+    // counts made by other threads while it runs may survive the reset
+    template<class Container>
+    void Recorder<Container>::reset() noexcept {
+        Registry &shared = registry();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        for (std::size_t i = 0; i < counter_count; ++i){
+            shared.retired[i] = 0;
+        }
+        for (Local *thread = shared.head; thread; thread = thread->next){
+            for (auto &value : thread->values){
+                value.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    template<class Container>
+    Recorder<Container>::Local::Local() {
+        Registry &shared = registry();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        next = shared.head;
+        if (next){
+            next->prev = this;
+        }
+        shared.head = this;
+    }
+
+    // the counts of an ending thread are kept in the registry
+    template<class Container>
+    Recorder<Container>::Local::~Local() {
+        Registry &shared = registry();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        for (std::size_t i = 0; i < counter_count; ++i){
+            std::uint64_t value = values[i].load(std::memory_order_relaxed);
+            shared.retired[i] = is_peak(i) ? (value > shared.retired[i] ? value : shared.retired[i]) : shared.retired[i] + value;
+        }
+        (prev ? prev->next : shared.head) = next;
+        if (next){
+            next->prev = prev;
+        }
+    }
+
+    // private member function, built before the first Local so it outlives them all
+    template<class Container>
+    typename Recorder<Container>::Registry &Recorder<Container>::registry() noexcept {
+        static Registry shared;
+        return shared;
+    }
+
+    // private member function
+    template<class Container>
+    typename Recorder<Container>::Local &Recorder<Container>::local() noexcept {
+        thread_local Local counters;
+        return counters;
+    }
+
+    // private member function, only the owning thread writes its counters:
+    // a relaxed load and store, no read-modify-write
+    template<class Container>
+    void Recorder<Container>::add(Counter counter, std::uint64_t count) noexcept {
+        std::atomic<std::uint64_t> &value = local().values[counter];
+        value.store(value.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+    }
+
+    // private member function
+    template<class Container>
+    void Recorder<Container>::raise(Counter counter, std::uint64_t value) noexcept {
+        std::atomic<std::uint64_t> &peak = local().values[counter];
+        if (peak.load(std::memory_order_relaxed) < value){
+            peak.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    // private member function
+    template<class Container>
+    bool Recorder<Container>::is_peak(std::size_t counter) noexcept {
+        return counter == peak_size || counter == peak_capacity;
+    }
+#else
+    template<class Container>
+    void Recorder<Container>::allocation(std::size_t) noexcept {}
+
+    template<class Container>
+    void Recorder<Container>::deallocation() noexcept {}
+
+    template<class Container>
+    void Recorder<Container>::reallocation() noexcept {}
+
+    template<class Container>
+    void Recorder<Container>::moved(std::size_t) noexcept {}
+
+    template<class Container>
+    void Recorder<Container>::copied(std::size_t) noexcept {}
+
+    template<class Container>
+    template<class T, class... Args>
+    void Recorder<Container>::constructed(std::size_t) noexcept {}
+
+    template<class Container>
+    void Recorder<Container>::walked(std::size_t) noexcept {}
+
+    template<class Container>
+    void Recorder<Container>::size(std::size_t) noexcept {}
+
+    template<class Container>
+    void Recorder<Container>::capacity(std::size_t) noexcept {}
+
+    template<class Container>
+    Snapshot Recorder<Container>::snapshot() noexcept {
+        return Snapshot();
+    }
+
+    template<class Container>
+    void Recorder<Container>::reset() noexcept {}
+#endif
+
+} // namespace stats
+} // namespace container
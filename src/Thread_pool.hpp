@@ -0,0 +1,253 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Deque.hpp"
+
+namespace container {
+namespace parallel {
+
+    // Work-stealing pool running batches of indexed chunks. Every worker has
+    // its own queue: it takes its newest task first and, once its queue is
+    // empty, steals the oldest task of another worker. The thread that submits
+    // a batch works on it too until the batch is done, so a pool without
+    // workers still runs every batch, and a chunk may submit a nested batch.
+    class Thread_pool {
+    public:
+        explicit Thread_pool(std::size_t workers = default_workers());
+        Thread_pool(const Thread_pool &other) = delete;
+        Thread_pool &operator=(const Thread_pool &other) = delete;
+        ~Thread_pool();
+
+        // threads working on a batch: the workers and the submitting thread
+        std::size_t concurrency() const noexcept;
+
+        // Runs fn(i) for every i in [0, chunks) and returns once all are done.
+        // The first exception thrown by a chunk is rethrown here. If queueing
+        // the chunks fails, the chunks already queued still run and the
+        // queueing error is rethrown once they are done.
+        template<class Fn>
+        void run_chunks(std::size_t chunks, Fn &&fn);
+
+        static std::size_t default_workers();
+
+    private:
+        // Chunks of one run_chunks call
+        struct Batch {
+            std::function<void(std::size_t)> fn;
+            std::atomic<std::size_t> remaining;
+            std::exception_ptr error;
+            std::mutex mutex; // guards error and the wake up of the submitter
+            std::condition_variable done;
+        };
+
+        struct Task {
+            Batch *batch;
+            std::size_t index;
+        };
+
+        struct Worker_queue {
+            std::mutex mutex;
+            Deque<Task> tasks;
+        };
+
+        // Pool and queue of a worker thread
+        struct Worker_id {
+            const Thread_pool *pool;
+            std::size_t index;
+        };
+
+        void work(std::size_t index);
+        bool pop_local(std::size_t index, Task &task);
+        bool steal(std::size_t thief, Task &task);
+        void execute(const Task &task);
+        std::size_t current_worker() const noexcept;
+        static Worker_id &thread_local_worker() noexcept;
+
+    private: // members
+        std::vector<std::unique_ptr<Worker_queue>> m_queues;
+        std::vector<std::thread> m_threads;
+        std::atomic<std::size_t> m_pending; // queued tasks not taken yet
+        std::atomic<std::size_t> m_next_queue; // round robin for outside submitters
+        std::mutex m_sleep_mutex;
+        std::condition_variable m_wake;
+        bool m_stop;
+    };
+
+    // Pool shared by the parallel algorithms unless they are given another
+    inline Thread_pool &default_pool() {
+        static Thread_pool pool;
+        return pool;
+    }
+
+//-------------- Class Thread_pool Implementation ------------//
+    inline Thread_pool::Thread_pool(std::size_t workers)
+        :m_pending{0}, m_next_queue{0}, m_stop{false} {
+        // one queue more than workers: outside submitters use it as well
+        for (std::size_t i = 0; i <= workers; ++i){
+            m_queues.push_back(std::make_unique<Worker_queue>());
+        }
+        for (std::size_t i = 0; i < workers; ++i){
+            m_threads.emplace_back([this, i]{ work(i); });
+        }
+    }
+
+    inline Thread_pool::~Thread_pool(){
+        {
+            std::lock_guard<std::mutex> lock{m_sleep_mutex};
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (auto &thread : m_threads){
+            thread.join();
+        }
+    }
+
+    inline std::size_t Thread_pool::concurrency() const noexcept {
+        return m_threads.size() + 1;
+    }
+
+    // the submitting thread takes part, one worker per remaining core
+    inline std::size_t Thread_pool::default_workers() {
+        const std::size_t cores = std::thread::hardware_concurrency();
+        return cores > 1 ? cores - 1 : 0;
+    }
+
+    template<class Fn>
+    void Thread_pool::run_chunks(std::size_t chunks, Fn &&fn){
+        if (chunks == 0){
+            return;
+        }
+        Batch batch;
+        batch.fn = std::forward<Fn>(fn);
+        batch.remaining.store(chunks, std::memory_order_relaxed);
+
+        // a worker keeps the batch in its own queue, others deal it out
+        const std::size_t own = current_worker();
+        m_pending.fetch_add(chunks, std::memory_order_release);
+        std::size_t queued = 0;
+        std::exception_ptr queue_error;
+        try {
+            for (; queued < chunks; ++queued){
+                const std::size_t queue = own < m_queues.size() ? own : m_next_queue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+                std::lock_guard<std::mutex> lock{m_queues[queue]->mutex};
+                m_queues[queue]->tasks.push_back(Task{&batch, queued});
+            }
+        } catch (...) {
+            // the chunks that were not queued never run: stop counting them,
+            // the queued ones still point at the batch and are waited for below
+            queue_error = std::current_exception();
+            m_pending.fetch_sub(chunks - queued, std::memory_order_relaxed);
+            batch.remaining.fetch_sub(chunks - queued, std::memory_order_acq_rel);
+        }
+        {
+            std::lock_guard<std::mutex> lock{m_sleep_mutex};
+        }
+        m_wake.notify_all();
+
+        // help until every chunk of the batch has run
+        const std::size_t self = own < m_queues.size() ? own : m_queues.size() - 1;
+        Task task{};
+        while (batch.remaining.load(std::memory_order_acquire) != 0){
+            if (pop_local(self, task) || steal(self, task)){
+                execute(task);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock{batch.mutex};
+            batch.done.wait(lock, [&batch]{ return batch.remaining.load(std::memory_order_acquire) == 0; });
+        }
+
+        std::lock_guard<std::mutex> lock{batch.mutex};
+        if (queue_error){
+            std::rethrow_exception(queue_error);
+        }
+        if (batch.error){
+            std::rethrow_exception(batch.error);
+        }
+    }
+
+    // private member function
+    inline void Thread_pool::work(std::size_t index){
+        thread_local_worker() = {this, index};
+        Task task{};
+        for (;;){
+            if (pop_local(index, task) || steal(index, task)){
+                execute(task);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock{m_sleep_mutex};
+            m_wake.wait(lock, [this]{ return m_stop || m_pending.load(std::memory_order_acquire) != 0; });
+            if (m_stop){
+                return;
+            }
+        }
+    }
+
+    // private member function, newest task of the queue
+    inline bool Thread_pool::pop_local(std::size_t index, Task &task){
+        Worker_queue &queue = *m_queues[index];
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        if (queue.tasks.empty()){
+            return false;
+        }
+        task = queue.tasks.back();
+        queue.tasks.pop_back();
+        m_pending.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // private member function, oldest task of the first other queue holding one
+    inline bool Thread_pool::steal(std::size_t thief, Task &task){
+        for (std::size_t offset = 1; offset < m_queues.size(); ++offset){
+            Worker_queue &queue = *m_queues[(thief + offset) % m_queues.size()];
+            std::lock_guard<std::mutex> lock{queue.mutex};
+            if (!queue.tasks.empty()){
+                task = queue.tasks.front();
+                queue.tasks.pop_front();
+                m_pending.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // private member function
+    inline void Thread_pool::execute(const Task &task){
+        Batch &batch = *task.batch;
+        try {
+            batch.fn(task.index);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock{batch.mutex};
+            if (!batch.error){
+                batch.error = std::current_exception();
+            }
+        }
+        // under the lock: the submitter destroys the batch once it can take it
+        std::lock_guard<std::mutex> lock{batch.mutex};
+        if (batch.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1){
+            batch.done.notify_all();
+        }
+    }
+
+    // private member function, queue of the calling thread when it is a worker
+    // of this pool, an index past the queues otherwise
+    inline std::size_t Thread_pool::current_worker() const noexcept {
+        const auto &worker = thread_local_worker();
+        return worker.pool == this ? worker.index : m_queues.size();
+    }
+
+    // private member function
+    inline Thread_pool::Worker_id &Thread_pool::thread_local_worker() noexcept {
+        thread_local Worker_id worker{nullptr, 0};
+        return worker;
+    }
+
+} // namespace parallel
+} // namespace container
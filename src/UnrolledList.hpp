@@ -0,0 +1,739 @@
+#pragma once
+
+#include <stdexcept>
+#include <initializer_list>
+#include <sstream>
+#include <memory>
+#include <algorithm>
+#include <utility>
+
+namespace container {
+
+	// Doubly linked list keeping up to B elements per node in a contiguous
+	// array: scans touch one node per B elements and a mid-list insert shifts
+	// at most B elements. A full node is split in two, a node that drains
+	// below half is merged with the next one when both fit.
+	template <typename T, std::size_t B = 16, typename Allocator = std::allocator<T>>
+	class UnrolledList {
+			static_assert(B >= 2, "UnrolledList needs at least two elements per node");
+
+			// Node of the list, values [0, count) are constructed. The end node
+			// holds no values.
+			struct Node{
+				Node(Node* next_ , Node* prev_)
+					:next{next_}, prev{prev_}, count{0} {}
+				~Node() {}
+
+				Node *next;
+				Node *prev;
+				std::size_t count;
+				union {
+					T values[B];
+				};
+			};
+
+			// allocator rebound to the node type
+			using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+			using node_traits = std::allocator_traits<node_allocator>;
+
+		public:
+			using value_type = T;
+			using allocator_type = Allocator;
+			static constexpr std::size_t node_capacity = B;
+
+			// Constructors, destructor, assignment operators
+			UnrolledList();
+			explicit UnrolledList(const Allocator &alloc);
+			UnrolledList(const UnrolledList &list); //copy constructor
+			UnrolledList(UnrolledList && list) noexcept; // move constructor
+			UnrolledList(const std::initializer_list<T> &elements, const Allocator &alloc = Allocator()); //initializer list constructor
+			virtual ~UnrolledList();
+
+			UnrolledList<T, B, Allocator> &operator=(const UnrolledList &list); // implements copy swap idiom
+			UnrolledList<T, B, Allocator> &operator=(UnrolledList &&list) noexcept;
+			allocator_type get_allocator() const;
+
+			// Element access
+			T &operator[](const std::size_t index);
+			const T &operator[](const std::size_t index) const;
+
+			// Inner classes
+			class const_iterator;
+			class iterator;
+
+			// Iterators
+			iterator begin() noexcept;
+			const_iterator begin() const noexcept;
+			const_iterator cbegin() const noexcept;
+			iterator end() noexcept;
+			const_iterator end() const noexcept;
+			const_iterator cend() const noexcept;
+
+			// Capacity
+			bool empty() const;
+			std::size_t size()const;
+			std::size_t node_count() const noexcept;
+
+			// Modifiers
+			void clear();
+			template<class... Args>
+			iterator emplace(const_iterator it, Args&&... args);
+			template<class... Args>
+			T &emplace_front(Args&&... args);
+			template<class... Args>
+			T &emplace_back(Args&&... args);
+			iterator insert(const_iterator it, const T &value);
+			iterator insert(const_iterator it, T &&value);
+			void push_front(const T &value);
+			void push_front(T &&value);
+			void push_mid(const T &value);
+			void push_mid(T &&value);
+			void push_back(const T &value);
+			void push_back(T &&value);
+			iterator erase(const_iterator it);
+			iterator erase(const std::size_t index);
+			void pop_front();
+			void pop_back();
+			void swap(UnrolledList<T, B, Allocator> &list) noexcept;
+
+			//Operations
+			void reverse() noexcept;
+			std::string toString(const std::string &name = "") const;
+
+			bool operator==(const UnrolledList &other) const;
+			bool operator!=(const UnrolledList &other) const;
+
+	private:
+			std::size_t m_size{};
+			std::size_t m_nodes{}; // nodes holding elements
+			Node *head;
+			Node *tail; // end node
+			node_allocator m_alloc;
+
+			// helpers
+			const_iterator seek(const std::size_t index) const;
+			Node *create_node(Node *next, Node *prev);
+			void destroy_node(Node *node) noexcept;
+			void unlink_node(Node *node) noexcept;
+			Node *split(Node *node);
+			void merge_next(Node *node) noexcept;
+			void free_nodes() noexcept;
+	};
+
+//-------------- Class UnrolledList Implementation --------------//
+	// Constructors, destructor assign operator //
+	template <typename T, std::size_t B, typename Allocator>
+	UnrolledList<T, B, Allocator>::UnrolledList() :UnrolledList{Allocator()} {}
+
+	template <typename T, std::size_t B, typename Allocator>
+	UnrolledList<T, B, Allocator>::UnrolledList(const Allocator &alloc) :m_size{}, head{nullptr}, tail{nullptr}, m_alloc{alloc} {
+		head = tail = create_node(nullptr, nullptr);
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	UnrolledList<T, B, Allocator>::UnrolledList(const UnrolledList &list)
+		:UnrolledList{std::allocator_traits<Allocator>::select_on_container_copy_construction(list.get_allocator())} {
+		for (const auto &it : list) {
+			push_back(it);
+		}
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	UnrolledList<T, B, Allocator>::UnrolledList(UnrolledList &&list) noexcept :UnrolledList{list.get_allocator()} {
+		swap(list);
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	UnrolledList<T, B, Allocator>::UnrolledList(const std::initializer_list<T> &elements, const Allocator &alloc) :UnrolledList{alloc} {
+		for (auto &element: elements)	{
+			push_back(element);
+		}
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	UnrolledList<T, B, Allocator>::~UnrolledList(){
+		free_nodes();
+	}
+
+	template<typename T, std::size_t B, typename Allocator>
+	UnrolledList<T, B, Allocator>& UnrolledList<T, B, Allocator>::operator=(const UnrolledList &list){
+		if (this != &list){
+			auto temp{list};
+			swap(temp);
+		}
+		return *this;
+	}
+
+	template<typename T, std::size_t B, typename Allocator>
+	UnrolledList<T, B, Allocator>& UnrolledList<T, B, Allocator>::operator=(UnrolledList &&list) noexcept {
+		if (this != &list){
+			swap(list);
+		}
+		return *this;
+	}
+
+	template<typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::allocator_type UnrolledList<T, B, Allocator>::get_allocator() const {
+		return allocator_type(m_alloc);
+	}
+
+	//--------------- Element access ---------------//
+	template<typename T, std::size_t B, typename Allocator>
+	T& UnrolledList<T, B, Allocator>::operator[](const std::size_t index) {
+		return seek(index).get();
+	}
+
+	template<typename T, std::size_t B, typename Allocator>
+	const T& UnrolledList<T, B, Allocator>::operator[](const std::size_t index) const {
+		return seek(index).get();
+	}
+
+	// private member function, skips whole nodes from the nearest end
+	template<typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::const_iterator UnrolledList<T, B, Allocator>::seek(const std::size_t index) const {
+		if (index >= m_size) {
+			throw std::out_of_range("ERROR: Index out of bounds in UnrolledList");
+		}
+		Node *temp = nullptr;
+		std::size_t position = 0;
+		if (index < m_size / 2) {
+			// normal way
+			temp = head;
+			for (; position + temp->count <= index; temp = temp->next) {
+				position += temp->count;
+			}
+		}else {
+			// reverse way
+			temp = tail->prev;
+			position = m_size - temp->count;
+			for (; position > index; position -= temp->count) {
+				temp = temp->prev;
+			}
+		}
+		return const_iterator{temp, index - position};
+	}
+
+	// private member function
+	template<typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::Node *UnrolledList<T, B, Allocator>::create_node(Node *next, Node *prev) {
+		Node *node = node_traits::allocate(m_alloc, 1);
+		node_traits::construct(m_alloc, node, next, prev);
+		return node;
+	}
+
+	// private member function, destroys the values of the node and frees it
+	template<typename T, std::size_t B, typename Allocator>
+	void UnrolledList<T, B, Allocator>::destroy_node(Node *node) noexcept {
+		for (std::size_t i = 0; i < node->count; ++i) {
+			node_traits::destroy(m_alloc, std::addressof(node->values[i]));
+		}
+		node_traits::destroy(m_alloc, node);
+		node_traits::deallocate(m_alloc, node, 1);
+	}
+
+	// private member function, takes an element node out of the chain
+	template<typename T, std::size_t B, typename Allocator>
+	void UnrolledList<T, B, Allocator>::unlink_node(Node *node) noexcept {
+		if (node->prev) {
+			node->prev->next = node->next;
+		} else {
+			head = node->next;
+		}
+		node->next->prev = node->prev;
+		--m_nodes;
+	}
+
+	// private member function, moves the upper half of a full node into a new
+	// node linked after it and returns the new node
+	template<typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::Node *UnrolledList<T, B, Allocator>::split(Node *node) {
+		Node *upper = create_node(node->next, node);
+		const std::size_t half = node->count / 2;
+		try {
+			for (std::size_t i = half; i < node->count; ++i) {
+				node_traits::construct(m_alloc, std::addressof(upper->values[upper->count]), std::move_if_noexcept(node->values[i]));
+				++upper->count;
+			}
+		} catch (...) {
+			destroy_node(upper);
+			throw;
+		}
+		for (std::size_t i = half; i < node->count; ++i) {
+			node_traits::destroy(m_alloc, std::addressof(node->values[i]));
+		}
+		node->count = half;
+		node->next->prev = upper;
+		node->next = upper;
+		++m_nodes;
+		return upper;
+	}
+
+	// private member function, moves the elements of the next node into node
+	// when both fit and frees the next node
+	template<typename T, std::size_t B, typename Allocator>
+	void UnrolledList<T, B, Allocator>::merge_next(Node *node) noexcept {
+		Node *next = node->next;
+		if (next == tail || node->count + next->count > B) {
+			return;
+		}
+		for (std::size_t i = 0; i < next->count; ++i) {
+			node_traits::construct(m_alloc, std::addressof(node->values[node->count]), std::move(next->values[i]));
+			++node->count;
+		}
+		unlink_node(next);
+		destroy_node(next);
+	}
+
+	// private member function
+	template<typename T, std::size_t B, typename Allocator>
+	void UnrolledList<T, B, Allocator>::free_nodes() noexcept {
+		if (!head) return;
+
+		while (head->next) {
+			head = head->next;
+			destroy_node(head->prev);
+		}
+		destroy_node(head);
+		head = tail = nullptr;
+		m_size = m_nodes = 0;
+	}
+
+	//-----------------  Iterators -----------------//
+	template<typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::iterator UnrolledList<T, B, Allocator>::begin() noexcept {
+		return iterator{head, 0};
+	}
+
+	template<typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::const_iterator UnrolledList<T, B, Allocator>::begin() const noexcept {
+		return cbegin();
+	}
+
+	template<typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::const_iterator UnrolledList<T, B, Allocator>::cbegin() const noexcept {
+		return const_iterator{head, 0};
+	}
+
+	template<typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::iterator UnrolledList<T, B, Allocator>::end() noexcept {
+		return iterator{tail, 0};
+	}
+
+	template<typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::const_iterator UnrolledList<T, B, Allocator>::end() const noexcept{
+		return cend();
+	}
+
+	template<typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::const_iterator UnrolledList<T, B, Allocator>::cend() const noexcept{
+		return const_iterator{tail, 0};
+	}
+
+	//-----------------  Capacity ------------------//
+	template<typename T, std::size_t B, typename Allocator>
+	std::size_t UnrolledList<T, B, Allocator>::size() const {
+		return m_size;
+	}
+
+	template<typename T, std::size_t B, typename Allocator>
+	bool UnrolledList<T, B, Allocator>::empty() const{
+		return head == tail;
+	}
+
+	template<typename T, std::size_t B, typename Allocator>
+	std::size_t UnrolledList<T, B, Allocator>::node_count() const noexcept {
+		return m_nodes;
+	}
+
+	//-----------------  Modifiers -----------------//
+	template<typename T, std::size_t B, typename Allocator>
+	void UnrolledList<T, B, Allocator>::clear() {
+		// every node including the end node is returned before a new end node is
+		// made, so a pooled allocator can give its chunks back
+		free_nodes();
+		head = tail = create_node(nullptr, nullptr);
+	}
+
+	// inserting before the end goes into the last node while it has room
+	template <typename T, std::size_t B, typename Allocator>
+	template <class... Args>
+	typename UnrolledList<T, B, Allocator>::iterator UnrolledList<T, B, Allocator>::emplace(const_iterator it, Args&&... args){
+		if (it.current_node == nullptr) {
+			throw std::runtime_error("ERROR: Empty or null Iterator");
+		}
+
+		Node *node = it.current_node;
+		std::size_t index = it.index;
+		if (node == tail && node->prev) {
+			node = node->prev;
+			index = node->count;
+		}
+
+		T value(std::forward<Args>(args)...); // args may refer to an element
+		if (node == tail || (node->next == tail && index == B)) {
+			// appending starts a new node instead of splitting the full last one
+			Node *prev = tail->prev;
+			node = create_node(tail, prev);
+			if (prev) {
+				prev->next = node;
+			} else {
+				head = node;
+			}
+			tail->prev = node;
+			index = 0;
+			++m_nodes;
+		} else if (node->count == B) {
+			Node *upper = split(node);
+			if (index > node->count) {
+				index -= node->count;
+				node = upper;
+			}
+		}
+
+		T *values = node->values;
+		if (index == node->count) {
+			node_traits::construct(m_alloc, std::addressof(values[index]), std::move(value));
+		} else {
+			node_traits::construct(m_alloc, std::addressof(values[node->count]), std::move(values[node->count - 1]));
+			std::move_backward(values + index, values + node->count - 1, values + node->count);
+			values[index] = std::move(value);
+		}
+		++node->count;
+		++m_size;
+
+		return iterator{node, index};
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	template <class... Args>
+	T &UnrolledList<T, B, Allocator>::emplace_front(Args&&... args){
+		return *emplace(begin(), std::forward<Args>(args)...);
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	template <class... Args>
+	T &UnrolledList<T, B, Allocator>::emplace_back(Args&&... args){
+		return *emplace(end(), std::forward<Args>(args)...);
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::iterator UnrolledList<T, B, Allocator>::insert(const_iterator it, const T &value){
+		return emplace(it, value);
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::iterator UnrolledList<T, B, Allocator>::insert(const_iterator it, T &&value) {
+		return emplace(it, std::move(value));
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	void UnrolledList<T, B, Allocator>::push_front(const T &value) {
+		emplace(begin(), value);
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	void UnrolledList<T, B, Allocator>::push_front(T &&value) {
+		emplace(begin(), std::move(value));
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	void UnrolledList<T, B, Allocator>::push_mid(const T &value) {
+		if(!empty()){
+			insert(seek(m_size/2), value);
+		}else {
+			push_front(value);
+		}
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	void UnrolledList<T, B, Allocator>::push_mid(T &&value) {
+		if(!empty()){
+			insert(seek(m_size/2), std::move(value));
+		}else {
+			push_front(std::move(value));
+		}
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	void UnrolledList<T, B, Allocator>::push_back(const T &value) {
+		emplace(end(), value);
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	void UnrolledList<T, B, Allocator>::push_back(T &&value) {
+		emplace(end(), std::move(value));
+	}
+
+	// a node left less than half full takes in the next node when they fit together
+	template <typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::iterator UnrolledList<T, B, Allocator>::erase(const_iterator it) {
+		Node *node = it.current_node;
+		std::size_t index = it.index;
+		if (!node || node == tail || index >= node->count){
+			return iterator{node, index};
+		}
+
+		T *values = node->values;
+		std::move(values + index + 1, values + node->count, values + index);
+		node_traits::destroy(m_alloc, std::addressof(values[node->count - 1]));
+		--node->count;
+		--m_size;
+
+		if (node->count == 0) {
+			Node *next = node->next;
+			unlink_node(node);
+			destroy_node(node);
+			return iterator{next, 0};
+		}
+		if (node->count < B / 2) {
+			merge_next(node);
+		}
+		if (index == node->count) {
+			return iterator{node->next, 0};
+		}
+		return iterator{node, index};
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::iterator UnrolledList<T, B, Allocator>::erase(const std::size_t index) {
+		return erase(seek(index));
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	void UnrolledList<T, B, Allocator>::pop_front() {
+		if (empty()) {
+			throw std::runtime_error("ERROR: Empty container");
+		}
+		erase(begin());
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	void UnrolledList<T, B, Allocator>::pop_back() {
+		if (empty()) {
+			throw std::runtime_error("ERROR: Empty container");
+		}
+		erase(const_iterator{tail->prev, tail->prev->count - 1});
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	void UnrolledList<T, B, Allocator>::swap(UnrolledList<T, B, Allocator> &list) noexcept {
+		std::swap(head, list.head);
+		std::swap(tail, list.tail);
+		std::swap(m_size, list.m_size);
+		std::swap(m_nodes, list.m_nodes);
+		if constexpr (node_traits::propagate_on_container_swap::value){
+			std::swap(m_alloc, list.m_alloc);
+		}
+	}
+
+	//-----------------  Operations -----------------//
+	// relinks the nodes in the opposite order and reverses each node's array
+	template<typename T, std::size_t B, typename Allocator>
+	void UnrolledList<T, B, Allocator>::reverse() noexcept {
+		if (empty()) {
+			return;
+		}
+		Node *first = head;
+		Node *last = tail->prev;
+		for (Node *node = head; node != tail;) {
+			Node *next = node->next;
+			std::reverse(node->values, node->values + node->count);
+			std::swap(node->next, node->prev);
+			node = next;
+		}
+		head = last;
+		head->prev = nullptr;
+		first->next = tail;
+		tail->prev = first;
+	}
+
+	template<typename T, std::size_t B, typename Allocator>
+	std::string UnrolledList<T, B, Allocator>::toString(const std::string & name) const {
+		std::stringstream stream;
+		stream << "\n<===== UnrolledList: " << name << " ======>\n >>Size:" << m_size;
+		std::size_t index = 0;
+		for (const auto &it : *this) {
+			stream << "\n [" << index << "]=> " << it ;
+			index++;
+		}
+		stream << "\n<=== End " << name << " ====>\n";
+		return stream.str();
+	}
+
+	template<typename T, std::size_t B, typename Allocator>
+    bool UnrolledList<T, B, Allocator>::operator==(const UnrolledList& other) const{
+		if (m_size != other.m_size) {
+			return false;
+		}
+		auto itOther = other.cbegin();
+		for (auto it = cbegin(); it != cend(); ++it, ++itOther) {
+			if(*it != *itOther){
+				return false;
+			}
+		}
+		return true;
+    }
+
+    template<typename T, std::size_t B, typename Allocator>
+    bool UnrolledList<T, B, Allocator>::operator!=(const UnrolledList& other) const{
+        return !(operator==(other));
+    }
+
+	//---------------- Non-member functions ----------------//
+	template<typename T, std::size_t B, typename Allocator>
+	std::ostream& operator<<(std::ostream& os, const UnrolledList<T, B, Allocator> & list) {
+		for (const auto &it : list) {
+			os << it << "->";
+		}
+		os << "NULL";
+
+		return os;
+	}
+
+	//-------------- Inner class const_iterator --------//
+	template <typename T, std::size_t B, typename Allocator>
+	class UnrolledList<T, B, Allocator>::const_iterator {
+	public:
+		const_iterator();
+
+		const T & operator*() const;
+		const_iterator & operator++(); // Prefix
+		const_iterator operator++(int);// Postfix
+		const_iterator & operator--(); // Prefix
+		const_iterator operator--(int);// Postfix
+		bool operator==(const const_iterator & other) const;
+		bool operator!=(const const_iterator & other) const;
+
+	protected:
+		Node *current_node{}; // members
+		std::size_t index{}; // position inside the node
+
+		const_iterator(Node *new_ptr, std::size_t new_index); // constructor
+		T &get() const; // get the value at the iterator current position
+		friend class UnrolledList<T, B, Allocator>;
+	};
+
+	//-------------- Inner class iterator --------//
+	template <typename T, std::size_t B, typename Allocator>
+	class UnrolledList<T, B, Allocator>::iterator final: public const_iterator {
+	public:
+		iterator();
+
+		T &operator*();
+		const T &operator*() const;
+
+		iterator &operator++();
+		iterator operator++(int);
+		iterator &operator--();
+		iterator operator--(int);
+
+	private:
+		iterator(Node *new_ptr, std::size_t new_index); // constructor
+		friend class UnrolledList<T, B, Allocator>;
+	};
+
+	//-------------- class const_iterator implementation--------//
+	template <typename T, std::size_t B, typename Allocator>
+	UnrolledList<T, B, Allocator>::const_iterator::const_iterator() :current_node{nullptr}, index{0} {}
+
+	//protected constructor
+	template <typename T, std::size_t B, typename Allocator>
+	UnrolledList<T, B, Allocator>::const_iterator::const_iterator (Node *new_ptr, std::size_t new_index)
+		:current_node{new_ptr}, index{new_index} {}
+
+	template <typename T, std::size_t B, typename Allocator>
+	const T &UnrolledList<T, B, Allocator>::const_iterator::operator*() const{
+		return get();
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	T &UnrolledList<T, B, Allocator>::const_iterator::get() const{
+		return current_node->values[index];
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::const_iterator &UnrolledList<T, B, Allocator>::const_iterator::operator++(){ // Prefix
+		if (++index >= current_node->count) {
+			current_node = current_node->next;
+			index = 0;
+		}
+		return *this;
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::const_iterator UnrolledList<T, B, Allocator>::const_iterator::operator++(int){ // Postfix
+		const_iterator temp = *this;
+		++(*this);
+		return temp;
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::const_iterator &UnrolledList<T, B, Allocator>::const_iterator::operator--(){ // Prefix
+		if (index == 0) {
+			current_node = current_node->prev;
+			index = current_node->count;
+		}
+		--index;
+		return *this;
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::const_iterator UnrolledList<T, B, Allocator>::const_iterator::operator--(int){ // Postfix
+		const_iterator temp = *this;
+		--(*this);
+		return temp;
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	bool UnrolledList<T, B, Allocator>::const_iterator::operator==(const const_iterator &other) const {
+		return current_node == other.current_node && index == other.index;
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	bool UnrolledList<T, B, Allocator>::const_iterator::operator!=(const const_iterator &other) const {
+		return !(*this == other);
+	}
+
+	//-------------- Class iterator implementation --------//
+	template <typename T, std::size_t B, typename Allocator>
+	UnrolledList<T, B, Allocator>::iterator::iterator() :const_iterator{} {}
+
+	template <typename T, std::size_t B, typename Allocator>
+	UnrolledList<T, B, Allocator>::iterator::iterator(Node *new_ptr, std::size_t new_index) :const_iterator {new_ptr, new_index} {}
+
+	template <typename T, std::size_t B, typename Allocator>
+	const T &UnrolledList<T, B, Allocator>::iterator::operator*() const {
+		return const_iterator::operator*();
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	T &UnrolledList<T, B, Allocator>::iterator::operator*() {
+		return const_iterator::get();
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::iterator &UnrolledList<T, B, Allocator>::iterator::operator++(){
+		const_iterator::operator++();
+		return *this;
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::iterator UnrolledList<T, B, Allocator>::iterator::operator++(int){
+		iterator temp = *this;
+		++(*this);
+		return temp;
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::iterator &UnrolledList<T, B, Allocator>::iterator::operator--(){
+		const_iterator::operator--();
+		return *this;
+	}
+
+	template <typename T, std::size_t B, typename Allocator>
+	typename UnrolledList<T, B, Allocator>::iterator UnrolledList<T, B, Allocator>::iterator::operator--(int){
+		iterator temp = *this;
+		--(*this);
+		return temp;
+	}
+} // namespace  container
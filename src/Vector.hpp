@@ -1,27 +1,85 @@
 #pragma once
 
+#include <algorithm>
 #include <stdexcept>
 #include <initializer_list>
 #include <sstream>
+#include <iterator>
+#include <memory>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include "Growth_policy.hpp"
+#include "Simd.hpp"
+#include "Format.hpp"
+#include "Stats.hpp"
 
 namespace container {
+    // Types whose objects can be moved to new storage with memcpy, leaving the
+    // old bytes unused without running their destructor. Trivially copyable
+    // types qualify; other types may opt in with a specialization.
     template<typename T>
+    struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+    // Iterators that can be walked more than once, so a range can be measured
+    // before it is copied
+    template<typename It, typename = void>
+    struct is_forward_iterator : std::false_type {};
+
+    template<typename It>
+    struct is_forward_iterator<It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+        : std::is_convertible<typename std::iterator_traits<It>::iterator_category, std::forward_iterator_tag> {};
+
+    // Storage living inside the object that owns a Vector (see SmallVector).
+    // A Vector handed such a buffer uses it before the heap and returns to it
+    // once its elements are cleared or moved out.
+    template<typename T>
+    struct Inline_buffer {
+        T *data;
+        std::size_t capacity;
+    };
+
+    template<typename T, typename Allocator = std::allocator<T>, typename Growth = Doubling_growth>
     class Vector {
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using recorder = stats::Recorder<Vector>; // operation counters, empty unless CONTAINER_STATS
+
+        // a non-const rvalue of a class derived from Vector, e.g. std::move(small_vector)
+        template<class Derived>
+        struct is_derived_rvalue : std::integral_constant<bool, std::is_base_of<Vector, Derived>::value &&
+            !std::is_same<Derived, Vector>::value && !std::is_const<Derived>::value> {};
+
     public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using growth_policy = Growth;
+
         // Constructors and destructor
         Vector();
-        explicit Vector(std::size_t count);
+        explicit Vector(const Allocator &alloc);
+        explicit Vector(std::size_t count, const Allocator &alloc = Allocator());
         Vector(const Vector& other); // copy constructor
         Vector(Vector &&other) noexcept; //move constructor
-        Vector(std::initializer_list<T> elements);
+        Vector(std::initializer_list<T> elements, const Allocator &alloc = Allocator());
         virtual ~Vector();
-        Vector<T> &operator=(const Vector &other); // applies copy and swap idiom
-        Vector<T> &operator=(Vector &&other) noexcept; // applies copy and swap idiom
+        Vector<T, Allocator, Growth> &operator=(const Vector &other); // applies copy and swap idiom
+        Vector<T, Allocator, Growth> &operator=(Vector &&other) noexcept(adopts_moved_storage);
+
+        // A SmallVector moved into a plain Vector would have its inline elements
+        // copied to a new block inside a noexcept move, so slicing it is refused
+        template<class Derived, typename = std::enable_if_t<is_derived_rvalue<Derived>::value>>
+        Vector(Derived &&other) = delete;
+        template<class Derived, typename = std::enable_if_t<is_derived_rvalue<Derived>::value>>
+        Vector &operator=(Derived &&other) = delete;
+        allocator_type get_allocator() const;
+
         // Element access
         T &at(std::size_t index);
         const T &at(std::size_t index) const;
         T &operator[](const std::size_t index);
         const T &operator[](const std::size_t index) const;
+        T *data() noexcept;
+        const T *data() const noexcept;
 
         // Inner classes
         class const_iterator;
@@ -39,72 +97,156 @@ namespace container {
         bool empty() const noexcept;
         void reserve(std::size_t new_cap);
         std::size_t size() const;
+        std::size_t capacity() const noexcept;
 
 
         // Modifiers
+        template<class... Args>
+        iterator emplace(const_iterator pos, Args&&... args);
+        template<class... Args>
+        T &emplace_back(Args&&... args);
         iterator insert(const_iterator pos, const T &value);
-        iterator insert(const_iterator pos, T &&value) noexcept;
+        iterator insert(const_iterator pos, T &&value);
         iterator insert(std::size_t pos, const T &value);
         iterator insert(std::size_t pos, T &&value);
+        iterator insert(const_iterator pos, std::size_t count, const T &value);
+        template<class InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+        iterator insert(const_iterator pos, InputIt first, InputIt last);
+        iterator insert(const_iterator pos, std::initializer_list<T> elements);
+        void assign(std::size_t count, const T &value);
+        template<class InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+        void assign(InputIt first, InputIt last);
+        void assign(std::initializer_list<T> elements);
+        template<class Range>
+        void append_range(Range &&range);
         void clear() noexcept;
         iterator erase(const_iterator pos);
         iterator erase(const std::size_t pos);
         void push_back(const T &value);
         void push_back( T&& value );
-        void swap(Vector &vector) noexcept;
+        void swap(Vector &vector); // throws only when an inline buffer is involved
+        void fill(const T &value);
 
 
         //Operations
         std::string toString(const std::string &name = "") const;  
+        std::string toString(const std::string &name, const Summary &summary) const;
+        void format_to(Text_buffer &buffer, const std::string &name = "", const Summary &summary = Summary()) const;
+        iterator find(const T &value);
+        const_iterator find(const T &value) const;
+        std::size_t count(const T &value) const;
+        bool contains(const T &value) const;
+        iterator min_element();
+        const_iterator min_element() const;
+        iterator max_element();
+        const_iterator max_element() const;
         bool operator==(const Vector& other) const;
         bool operator!=(const Vector& other) const;
+
+    protected:
+        // a move assignment that takes over the heap block of the source,
+        // never allocating, when the allocators propagate or always compare equal
+        static constexpr bool adopts_moved_storage = alloc_traits::propagate_on_container_move_assignment::value ||
+            alloc_traits::is_always_equal::value;
+
+        Vector(const Inline_buffer<T> *buffer, const Allocator &alloc);
+        void steal(Vector &other);
+        void move_assign(Vector &other);
+        bool is_inline(const T *data) const noexcept;
+
     private:    
         void move_data(T *from, T *to, std::size_t count);
-        T *check_to_insert(T *pos);
+        void transfer(T *from, std::size_t count, T *to);
+        void relocate(T *from, std::size_t count, T *to);
+        void release_storage() noexcept;
+        void swap_inline(Vector &other);
+        void trade_storage(Vector &other);
+        template<class... Args>
+        T *place(T *pos, Args&&... args);
+        template<class... Args>
+        void grow_and_emplace(Args&&... args);
+        template<class Construct, class Assign>
+        T *insert_n(T *pos, std::size_t count, Construct construct, Assign assign);
+        template<class Next>
+        void construct_n(T *to, std::size_t count, Next next);
+        template<class Next>
+        void assign_n(std::size_t count, Next next);
+        template<class It>
+        static constexpr bool is_bulk_copyable = std::is_trivially_copyable<T>::value &&
+            (std::is_same<It, T *>::value || std::is_same<It, const T *>::value ||
+             std::is_same<It, iterator>::value || std::is_same<It, const_iterator>::value);
         void push_back_checker();
+        T *allocate(std::size_t count); // raw storage, elements are constructed in place
+        void deallocate(T *data, std::size_t count) noexcept;
+        void destroy(T *first, T *last) noexcept;
 
     private: // members
         std::size_t m_size;
         std::size_t m_capacity;
         T *m_data;
+        Allocator m_alloc;
+        const Inline_buffer<T> *m_inline;
     };
 
 //-------------- Class Vector Implementation ------------//
     //------ Constructors, destructor ----------//
-    template<typename T>
-    Vector<T>::Vector() :m_size{}, m_capacity{}, m_data{nullptr} {};
-
-    template<typename T>
-    Vector<T>::Vector(const Vector &other) :m_size{other.m_size}, m_capacity{other.m_capacity} {
-        m_data = new T[m_size];
-        std::copy(other.m_data, other.m_data + m_size, m_data);
+    template<typename T, typename Allocator, typename Growth>
+    Vector<T, Allocator, Growth>::Vector() :Vector{Allocator()} {}
+
+    template<typename T, typename Allocator, typename Growth>
+    Vector<T, Allocator, Growth>::Vector(const Allocator &alloc)
+        :m_size{}, m_capacity{}, m_data{nullptr}, m_alloc{alloc}, m_inline{nullptr} {}
+
+    // protected constructor
+    template<typename T, typename Allocator, typename Growth>
+    Vector<T, Allocator, Growth>::Vector(const Inline_buffer<T> *buffer, const Allocator &alloc)
+        :m_size{}, m_capacity{buffer->capacity}, m_data{buffer->data}, m_alloc{alloc}, m_inline{buffer} {}
+
+    template<typename T, typename Allocator, typename Growth>
+    Vector<T, Allocator, Growth>::Vector(const Vector &other)
+        :Vector{alloc_traits::select_on_container_copy_construction(other.m_alloc)} {
+        reserve(other.m_size);
+        for (; m_size < other.m_size; ++m_size){
+            alloc_traits::construct(m_alloc, m_data + m_size, other.m_data[m_size]);
+        }
+        recorder::copied(m_size);
+        recorder::size(m_size);
     }
 
-    template<typename T>
-    Vector<T>::Vector(Vector &&other) noexcept :Vector{} {
-        swap(other);
+    // the allocator is copied from other, so its heap block always changes hands
+    template<typename T, typename Allocator, typename Growth>
+    Vector<T, Allocator, Growth>::Vector(Vector &&other) noexcept :Vector{other.m_alloc} {
+        steal(other);
     }
 
-    template<typename T>
-    Vector<T>::Vector(std::size_t count)
-        :m_size{count}, m_capacity{count}, m_data{new T[count]} {}
+    template<typename T, typename Allocator, typename Growth>
+    Vector<T, Allocator, Growth>::Vector(std::size_t count, const Allocator &alloc) :Vector{alloc} {
+        reserve(count);
+        for (; m_size < count; ++m_size){
+            alloc_traits::construct(m_alloc, m_data + m_size);
+        }
+        recorder::size(m_size);
+    }
 
-    template<typename T>
-    Vector<T>::Vector(std::initializer_list<T> elements) :Vector(elements.size()) {
-        std::size_t i = 0;
+    template<typename T, typename Allocator, typename Growth>
+    Vector<T, Allocator, Growth>::Vector(std::initializer_list<T> elements, const Allocator &alloc) :Vector{alloc} {
+        reserve(elements.size());
         for (auto& element :elements){
-            m_data[i++] = element;
+            alloc_traits::construct(m_alloc, m_data + m_size, element);
+            ++m_size;
         }
+        recorder::copied(m_size);
+        recorder::size(m_size);
     }
 
-    template<typename T>
-    Vector<T>::~Vector(){
+    template<typename T, typename Allocator, typename Growth>
+    Vector<T, Allocator, Growth>::~Vector(){
         clear();
     }
 
     // applying copy-and-swap idiom
-    template<typename T>
-    Vector<T> &Vector<T>::operator=(const Vector &other) {
+    template<typename T, typename Allocator, typename Growth>
+    Vector<T, Allocator, Growth> &Vector<T, Allocator, Growth>::operator=(const Vector &other) {
         if (this != &other){
             Vector temp{other};
             swap(temp);
@@ -112,97 +254,252 @@ namespace container {
         return *this;
     }
 
-    // applying copy-and-swap idiom
-    template<typename T>
-    Vector<T> &Vector<T>::operator=(Vector &&other) noexcept {
-        if (this != &other){
-            swap(other);
-        }
+    // frees the elements held and takes over those of other; with allocators that
+    // neither propagate nor always compare equal it may relocate them one by one
+    template<typename T, typename Allocator, typename Growth>
+    Vector<T, Allocator, Growth> &Vector<T, Allocator, Growth>::operator=(Vector &&other) noexcept(adopts_moved_storage) {
+        move_assign(other);
         return *this;
     }
+
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::allocator_type Vector<T, Allocator, Growth>::get_allocator() const {
+        return m_alloc;
+    }
     //--------------- Element access ---------------//
-    template<typename T>
-    T &Vector<T>::at(std::size_t index){
+    template<typename T, typename Allocator, typename Growth>
+    T &Vector<T, Allocator, Growth>::at(std::size_t index){
         if (index >= m_size){
 		    throw std::out_of_range("ERROR: Index out of bounds in Vector");
         }
         return m_data[index];
     }
 
-    template<typename T>
-    const T &Vector<T>::at(std::size_t index) const {
-        return at(index);
+    template<typename T, typename Allocator, typename Growth>
+    const T &Vector<T, Allocator, Growth>::at(std::size_t index) const {
+        if (index >= m_size){
+		    throw std::out_of_range("ERROR: Index out of bounds in Vector");
+        }
+        return m_data[index];
     }
 
-    template<typename T>
-    T &Vector<T>::operator[](const std::size_t index){
+    template<typename T, typename Allocator, typename Growth>
+    T &Vector<T, Allocator, Growth>::operator[](const std::size_t index){
         return m_data[index];
     }
 
-    template<typename T>
-    const T &Vector<T>::operator[](const std::size_t index) const {
+    template<typename T, typename Allocator, typename Growth>
+    const T &Vector<T, Allocator, Growth>::operator[](const std::size_t index) const {
         return m_data[index];
     }
 
+    template<typename T, typename Allocator, typename Growth>
+    T *Vector<T, Allocator, Growth>::data() noexcept {
+        return m_data;
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    const T *Vector<T, Allocator, Growth>::data() const noexcept {
+        return m_data;
+    }
+
     //-----------------  Iterators -----------------//
-	template<typename T>
-	typename Vector<T>::iterator Vector<T>::begin() noexcept {
+	template<typename T, typename Allocator, typename Growth>
+	typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::begin() noexcept {
 		return iterator(m_data);
 	}
 
-    template<typename T>
-	typename Vector<T>::const_iterator Vector<T>::begin() const noexcept{
+    template<typename T, typename Allocator, typename Growth>
+	typename Vector<T, Allocator, Growth>::const_iterator Vector<T, Allocator, Growth>::begin() const noexcept{
 		return cbegin();
 	}
 
-    template<typename T>
-	typename Vector<T>::const_iterator Vector<T>::cbegin() const noexcept{
+    template<typename T, typename Allocator, typename Growth>
+	typename Vector<T, Allocator, Growth>::const_iterator Vector<T, Allocator, Growth>::cbegin() const noexcept{
 		return const_iterator(m_data);
 	}
 
-    template<typename T>
-	typename Vector<T>::iterator Vector<T>::end() noexcept {
+    template<typename T, typename Allocator, typename Growth>
+	typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::end() noexcept {
 		return iterator(&m_data[m_size]);
 	}
 
-    template<typename T>
-	typename Vector<T>::const_iterator Vector<T>::end() const noexcept {
+    template<typename T, typename Allocator, typename Growth>
+	typename Vector<T, Allocator, Growth>::const_iterator Vector<T, Allocator, Growth>::end() const noexcept {
 		return cend();
 	}
 
-    template<typename T>
-	typename Vector<T>::const_iterator Vector<T>::cend() const noexcept{
+    template<typename T, typename Allocator, typename Growth>
+	typename Vector<T, Allocator, Growth>::const_iterator Vector<T, Allocator, Growth>::cend() const noexcept{
 		return const_iterator(&m_data[m_size]);
 	}
 
 
 
     //-----------------  Capacity ------------------//
-    template<typename T>
-    bool Vector<T>::empty() const noexcept{
+    template<typename T, typename Allocator, typename Growth>
+    bool Vector<T, Allocator, Growth>::empty() const noexcept{
         return size() == 0;
     }
 
-    template<typename T>
-    void Vector<T>::reserve(std::size_t new_cap){
+    // the growth policy may round new_cap up, Fixed_capacity throws std::length_error past its capacity
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::reserve(std::size_t new_cap){
         if (new_cap > m_capacity){
-            Vector temp(new_cap);
-            for (std::size_t i; i < m_size; ++i){
-                temp[i] = m_data[i];
+            new_cap = Growth::template reserve_capacity<T>(m_capacity, new_cap);
+            if (m_size){
+                recorder::reallocation();
             }
-            swap(temp);
+            T *data = allocate(new_cap);
+            try {
+                relocate(m_data, m_size, data);
+            } catch (...) {
+                deallocate(data, new_cap);
+                throw;
+            }
+            deallocate(m_data, m_capacity);
+            m_data = data;
+            m_capacity = new_cap;
         }
     }
 
 
-    template<typename T>
-    std::size_t Vector<T>::size() const{
+    template<typename T, typename Allocator, typename Growth>
+    std::size_t Vector<T, Allocator, Growth>::size() const{
         return m_size;
     }
 
+    template<typename T, typename Allocator, typename Growth>
+    std::size_t Vector<T, Allocator, Growth>::capacity() const noexcept{
+        return m_capacity;
+    }
+
     //private function
-    template<typename T>
-    void Vector<T>::move_data(T *from, T *to, std::size_t count){
+    template<typename T, typename Allocator, typename Growth>
+    T *Vector<T, Allocator, Growth>::allocate(std::size_t count){
+        if (!count){
+            return nullptr;
+        }
+        T *data = alloc_traits::allocate(m_alloc, count);
+        recorder::allocation(count * sizeof(T));
+        recorder::capacity(count);
+        return data;
+    }
+
+    //private function
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::deallocate(T *data, std::size_t count) noexcept{
+        if (data && !is_inline(data)){
+            alloc_traits::deallocate(m_alloc, data, count);
+            recorder::deallocation();
+        }
+    }
+
+    //private function, frees the storage and falls back to the inline buffer
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::release_storage() noexcept{
+        deallocate(m_data, m_capacity);
+        m_size = 0;
+        m_data = m_inline ? m_inline->data : nullptr;
+        m_capacity = m_inline ? m_inline->capacity : 0;
+    }
+
+    //private function, constructs count elements at `to` from the ones at `from`, which stay alive.
+    // Trivially relocatable elements are memcpy'd: their sources then count as destroyed.
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::transfer(T *from, std::size_t count, T *to){
+        if constexpr (is_trivially_relocatable<T>::value || std::is_nothrow_move_constructible<T>::value ||
+                      !std::is_copy_constructible<T>::value){
+            recorder::moved(count);
+        } else {
+            recorder::copied(count);
+        }
+        if constexpr (is_trivially_relocatable<T>::value){
+            if (count){
+                std::memcpy(static_cast<void *>(to), static_cast<const void *>(from), count * sizeof(T));
+            }
+        } else {
+            // moves unless a throwing move would lose the strong guarantee of a copy
+            construct_n(to, count, [&from]() -> decltype(auto) { return std::move_if_noexcept(*from++); });
+        }
+    }
+
+    //private function, constructs count elements at `to` and destroys the ones at `from`
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::relocate(T *from, std::size_t count, T *to){
+        transfer(from, count, to);
+        if constexpr (!is_trivially_relocatable<T>::value){
+            destroy(from, from + count);
+        }
+    }
+
+    //private function, constructs count elements at `to` from successive next() results,
+    // none of them if one throws
+    template<typename T, typename Allocator, typename Growth>
+    template<class Next>
+    void Vector<T, Allocator, Growth>::construct_n(T *to, std::size_t count, Next next){
+        std::size_t i = 0;
+        try {
+            for (; i < count; ++i){
+                alloc_traits::construct(m_alloc, to + i, next());
+            }
+        } catch (...) {
+            destroy(to, to + i);
+            throw;
+        }
+    }
+
+    // protected function, takes over the elements of other and leaves it empty;
+    // *this must not hold elements. Heap storage changes hands unless the
+    // elements fit into the inline buffer of *this.
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::steal(Vector &other){
+        bool fits_inline = m_inline && other.m_size <= m_inline->capacity;
+        if (!fits_inline && !other.is_inline(other.m_data) && (alloc_traits::is_always_equal::value || m_alloc == other.m_alloc)){
+            deallocate(m_data, m_capacity);
+            m_data = other.m_data;
+            m_capacity = other.m_capacity;
+            other.m_data = nullptr;
+        } else {
+            reserve(other.m_size);
+            relocate(other.m_data, other.m_size, m_data);
+        }
+        m_size = other.m_size;
+        recorder::size(m_size);
+        other.release_storage();
+    }
+
+    // protected function, the move assignment shared with SmallVector, which
+    // may move inline elements one by one
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::move_assign(Vector &other){
+        if (this != &other){
+            clear();
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value){
+                m_alloc = other.m_alloc;
+            }
+            steal(other);
+        }
+    }
+
+    // protected function
+    template<typename T, typename Allocator, typename Growth>
+    bool Vector<T, Allocator, Growth>::is_inline(const T *data) const noexcept{
+        return m_inline && data == m_inline->data;
+    }
+
+    //private function
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::destroy(T *first, T *last) noexcept{
+        for (; first != last; ++first){
+            alloc_traits::destroy(m_alloc, first);
+        }
+    }
+
+    //private function
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::move_data(T *from, T *to, std::size_t count){
+        recorder::moved(count);
         if (from < to){ // for insert operations
             T *_from = from + count - 1, *_to = to + count - 1;
             for (std::size_t i = count; i > 0; --i){
@@ -213,7 +510,7 @@ namespace container {
 
         if (from > to){ // for erase operations
             T *_from = from, *_to = to;
-            for (std::size_t i = 0; i < count - 1; ++i){
+            for (std::size_t i = 0; i < count; ++i){
                 *_to++ = std::move(*_from++);
             }
             return;
@@ -221,299 +518,811 @@ namespace container {
     }
 
     //-----------------  Modifiers -----------------//
-    template<typename T>
-    void Vector<T>::clear() noexcept {
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::clear() noexcept {
         if (m_data){
-            delete[] m_data;
-            m_data = nullptr;
-            m_size = 0;
-            m_capacity = 0;
+            destroy(m_data, m_data + m_size);
+            release_storage();
         }
     }
 
-    // private function member
-    template<typename T>
-    T *Vector<T>::check_to_insert(T *pos){
-        auto pos_to_check = pos;
-        if (pos_to_check < m_data || pos_to_check > &m_data[m_size] ){
+    // private function member, only [0, m_size) holds constructed elements:
+    // the new last slot is move constructed and the rest is shifted by assignment
+    template<typename T, typename Allocator, typename Growth>
+    template<class... Args>
+    T *Vector<T, Allocator, Growth>::place(T *pos, Args&&... args){
+        if (pos < m_data || pos > m_data + m_size){
            return nullptr;
         }
 
-        if (m_capacity < m_size) {
-            reserve (m_capacity*2);
+        auto index = pos - m_data;
+        if (pos == m_data + m_size){
+            return std::addressof(emplace_back(std::forward<Args>(args)...));
         }
 
-        move_data(pos_to_check, pos_to_check +1, m_size  - (pos_to_check - m_data));
-        return pos_to_check;
+        T value(std::forward<Args>(args)...); // args may refer to an element
+        recorder::template constructed<T, Args...>(1);
+        push_back_checker();
+        pos = m_data + index;
+        alloc_traits::construct(m_alloc, m_data + m_size, std::move(m_data[m_size - 1]));
+        ++m_size;
+        move_data(pos, pos + 1, m_size - 2 - index);
+        *pos = std::move(value);
+        recorder::moved(2);
+        recorder::size(m_size);
+        return pos;
+    }
 
+    template<typename T, typename Allocator, typename Growth>
+    template<class... Args>
+    typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::emplace(const_iterator pos, Args&&... args){
+        return iterator{place(pos.m_current, std::forward<Args>(args)...)};
     }
 
-    template<typename T>
-    typename Vector<T>::iterator Vector<T>::insert(const_iterator pos, const T &value){
-        auto to_insert = check_to_insert(pos.m_current);
-        if (to_insert != nullptr){
-            *to_insert = value;
-            ++m_size;
+    template<typename T, typename Allocator, typename Growth>
+    template<class... Args>
+    T &Vector<T, Allocator, Growth>::emplace_back(Args&&... args){
+        if (m_size == m_capacity){
+            grow_and_emplace(std::forward<Args>(args)...);
+        } else {
+            alloc_traits::construct(m_alloc, m_data + m_size, std::forward<Args>(args)...);
         }
-        return iterator{to_insert};
+        recorder::template constructed<T, Args...>(1);
+        recorder::size(m_size + 1);
+        return m_data[m_size++];
     }
 
-    template<typename T>
-    typename Vector<T>::iterator Vector<T>::insert(const_iterator pos, T &&value) noexcept {
-        auto to_insert = check_to_insert(pos.m_current);
-        if (to_insert != nullptr){
-            *to_insert = std::move(value);
-            ++m_size;
+    // private function member, emplace_back on a full Vector: the new element is
+    // constructed in the new storage while the old elements, which args may
+    // refer to, are still alive, and only then are they relocated
+    template<typename T, typename Allocator, typename Growth>
+    template<class... Args>
+    void Vector<T, Allocator, Growth>::grow_and_emplace(Args&&... args){
+        auto new_cap = Growth::template next_capacity<T>(m_capacity, m_size + 1);
+        T *data = allocate(new_cap);
+        try {
+            alloc_traits::construct(m_alloc, data + m_size, std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(data, new_cap);
+            throw;
+        }
+        try {
+            relocate(m_data, m_size, data);
+        } catch (...) {
+            alloc_traits::destroy(m_alloc, data + m_size);
+            deallocate(data, new_cap);
+            throw;
+        }
+        if (m_size){
+            recorder::reallocation();
         }
-        return iterator{to_insert};
+        deallocate(m_data, m_capacity);
+        m_data = data;
+        m_capacity = new_cap;
     }
 
-    template<typename T>
-    typename Vector<T>::iterator Vector<T>::insert(std::size_t pos, const T &value) {
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::insert(const_iterator pos, const T &value){
+        return iterator{place(pos.m_current, value)};
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::insert(const_iterator pos, T &&value) {
+        return iterator{place(pos.m_current, std::move(value))};
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::insert(std::size_t pos, const T &value) {
         return iterator{insert(const_iterator(&m_data[pos]), value)};
     }
 
-    template<typename T>
-    typename Vector<T>::iterator Vector<T>::insert(std::size_t pos, T &&value) {
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::insert(std::size_t pos, T &&value) {
         return iterator{insert(const_iterator(&m_data[pos]), std::move(value))};
     }
 
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::insert(const_iterator pos, std::size_t count, const T &value){
+        if (pos.m_current < m_data || pos.m_current > m_data + m_size){
+            return iterator{};
+        }
+        T copy(value); // value may refer to an element
+        recorder::copied(count);
+        return iterator{insert_n(pos.m_current, count,
+            [this, &copy](T *to, std::size_t, std::size_t n){ construct_n(to, n, [&copy]() -> const T & { return copy; }); },
+            [&copy](T *to, std::size_t, std::size_t n){ std::fill_n(to, n, copy); })};
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    template<class InputIt, typename>
+    typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::insert(const_iterator pos, InputIt first, InputIt last){
+        if (pos.m_current < m_data || pos.m_current > m_data + m_size){
+            return iterator{};
+        }
 
-    template<typename T>
-    typename Vector<T>::iterator Vector<T>::erase(const_iterator pos){
+        if constexpr (is_forward_iterator<InputIt>::value){
+            auto count = static_cast<std::size_t>(std::distance(first, last));
+            if constexpr (std::is_lvalue_reference<decltype(*first)>::value){
+                recorder::copied(count);
+            } else {
+                recorder::moved(count);
+            }
+            return iterator{insert_n(pos.m_current, count,
+                [this, &first](T *to, std::size_t offset, std::size_t n){
+                    auto source = std::next(first, static_cast<std::ptrdiff_t>(offset));
+                    if constexpr (is_bulk_copyable<InputIt>){
+                        if (n){
+                            std::memcpy(static_cast<void *>(to), static_cast<const void *>(std::addressof(*source)), n * sizeof(T));
+                        }
+                    } else {
+                        construct_n(to, n, [&source]() -> decltype(auto) { return *source++; });
+                    }
+                },
+                [&first](T *to, std::size_t offset, std::size_t n){
+                    std::copy_n(std::next(first, static_cast<std::ptrdiff_t>(offset)), n, to);
+                })};
+        } else {
+            // a single pass range is counted by buffering it
+            auto index = pos.m_current - m_data;
+            if (pos.m_current == m_data + m_size){
+                for (; first != last; ++first){
+                    emplace_back(*first);
+                }
+                return iterator{m_data + index};
+            }
+            Vector buffer{m_alloc};
+            for (; first != last; ++first){
+                buffer.emplace_back(*first);
+            }
+            return insert(pos, std::make_move_iterator(buffer.m_data), std::make_move_iterator(buffer.m_data + buffer.m_size));
+        }
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::insert(const_iterator pos, std::initializer_list<T> elements){
+        return insert(pos, elements.begin(), elements.end());
+    }
+
+    // private function member, opens a gap of count slots at pos with at most one
+    // reallocation and a single shift of the tail. construct(to, offset, n) builds
+    // source elements [offset, offset + n) in raw slots, assign(to, offset, n)
+    // assigns them over live ones.
+    template<typename T, typename Allocator, typename Growth>
+    template<class Construct, class Assign>
+    T *Vector<T, Allocator, Growth>::insert_n(T *pos, std::size_t count, Construct construct, Assign assign){
+        auto index = static_cast<std::size_t>(pos - m_data);
+        auto after = m_size - index;
+        if (count == 0){
+            return pos;
+        }
+
+        if (m_size + count > m_capacity){
+            if (m_size){
+                recorder::reallocation();
+            }
+            auto new_cap = Growth::template next_capacity<T>(m_capacity, m_size + count);
+            T *data = allocate(new_cap);
+            try {
+                construct(data + index, 0, count);
+            } catch (...) {
+                deallocate(data, new_cap);
+                throw;
+            }
+            try {
+                transfer(m_data, index, data);
+                try {
+                    transfer(pos, after, data + index + count);
+                } catch (...) {
+                    destroy(data, data + index);
+                    throw;
+                }
+            } catch (...) {
+                destroy(data + index, data + index + count);
+                deallocate(data, new_cap);
+                throw;
+            }
+            if constexpr (!is_trivially_relocatable<T>::value){
+                destroy(m_data, m_data + m_size);
+            }
+            deallocate(m_data, m_capacity);
+            m_data = data;
+            m_capacity = new_cap;
+            m_size += count;
+        } else if constexpr (is_trivially_relocatable<T>::value){
+            recorder::moved(after);
+            std::memmove(static_cast<void *>(pos + count), static_cast<const void *>(pos), after * sizeof(T));
+            try {
+                construct(pos, 0, count);
+            } catch (...) {
+                std::memmove(static_cast<void *>(pos), static_cast<const void *>(pos + count), after * sizeof(T));
+                throw;
+            }
+            m_size += count;
+        } else {
+            recorder::moved(after);
+            T *end = m_data + m_size;
+            if (after > count){
+                construct_n(end, count, [from = end - count]() mutable -> T && { return std::move(*from++); });
+                m_size += count;
+                std::move_backward(pos, end - count, end);
+                assign(pos, 0, count);
+            } else {
+                construct(end, after, count - after);
+                m_size += count - after;
+                try {
+                    construct_n(pos + count, after, [from = pos]() mutable -> T && { return std::move(*from++); });
+                } catch (...) {
+                    destroy(end, end + count - after);
+                    m_size -= count - after;
+                    throw;
+                }
+                m_size += after;
+                assign(pos, 0, after);
+            }
+        }
+        recorder::size(m_size);
+        return m_data + index;
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::assign(std::size_t count, const T &value){
+        T copy(value); // value may refer to an element
+        assign_n(count, [&copy]() -> const T & { return copy; });
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    template<class InputIt, typename>
+    void Vector<T, Allocator, Growth>::assign(InputIt first, InputIt last){
+        if constexpr (is_bulk_copyable<InputIt>){
+            auto count = static_cast<std::size_t>(last - first);
+            if (count > m_capacity){
+                clear();
+                reserve(count);
+            }
+            if (count){
+                std::memcpy(static_cast<void *>(m_data), static_cast<const void *>(std::addressof(*first)), count * sizeof(T));
+            }
+            m_size = count;
+            recorder::copied(count);
+            recorder::size(count);
+        } else if constexpr (is_forward_iterator<InputIt>::value){
+            assign_n(static_cast<std::size_t>(std::distance(first, last)), [&first]() -> decltype(auto) { return *first++; });
+        } else {
+            destroy(m_data, m_data + m_size);
+            m_size = 0;
+            for (; first != last; ++first){
+                emplace_back(*first);
+            }
+        }
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::assign(std::initializer_list<T> elements){
+        assign(elements.begin(), elements.end());
+    }
+
+    // private function member, replaces the elements by count next() results,
+    // reallocating only when they do not fit
+    template<typename T, typename Allocator, typename Growth>
+    template<class Next>
+    void Vector<T, Allocator, Growth>::assign_n(std::size_t count, Next next){
+        if (count > m_capacity){
+            clear();
+            reserve(count);
+        }
+        std::size_t common = count < m_size ? count : m_size;
+        for (std::size_t i = 0; i < common; ++i){
+            m_data[i] = next();
+        }
+        if (count > m_size){
+            construct_n(m_data + m_size, count - m_size, next);
+        } else {
+            destroy(m_data + count, m_data + m_size);
+        }
+        m_size = count;
+        if constexpr (std::is_lvalue_reference<decltype(next())>::value){
+            recorder::copied(count);
+        } else {
+            recorder::moved(count);
+        }
+        recorder::size(count);
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    template<class Range>
+    void Vector<T, Allocator, Growth>::append_range(Range &&range){
+        using std::begin;
+        using std::end;
+        insert(cend(), begin(range), end(range));
+    }
+
+
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::erase(const_iterator pos){
         auto to_erase = pos.m_current;
         if (to_erase < m_data || to_erase >= &m_data[m_size] ){
             return iterator{};
         }
 
-        move_data(to_erase + 1, to_erase, m_size  - (to_erase - m_data));
-        --m_size;
+        move_data(to_erase + 1, to_erase, m_size - (to_erase - m_data) - 1);
+        alloc_traits::destroy(m_alloc, m_data + --m_size);
         return iterator{pos.m_current};
     }
 
-    template<typename T>
-    typename Vector<T>::iterator Vector<T>::erase(const std::size_t pos){
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::erase(const std::size_t pos){
         if (pos < m_size){
             return erase(const_iterator(m_data + pos));
         }
         return iterator{};
     }
 
-    template<typename T>
-    void Vector<T>::push_back(const T &value){
-        push_back_checker();
-        m_data[m_size++] = value;
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::push_back(const T &value){
+        emplace_back(value);
     }
 
-    template<typename T>
-    void Vector<T>::push_back(T &&value){
-        push_back_checker();
-        m_data[m_size++] =  std::move(value);
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::push_back(T &&value){
+        emplace_back(std::move(value));
     }
 
-    template<typename T>
-    void Vector<T>::push_back_checker() {
-        if (!m_capacity){
-            reserve(5);
-        } else if (m_capacity < m_size){
-            reserve(2 * m_capacity);
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::push_back_checker() {
+        if (m_capacity == m_size){
+            reserve(Growth::template next_capacity<T>(m_capacity, m_size + 1));
+        }
+    }
+
+    // Heap storage changes hands in O(1). An inline buffer cannot: its elements
+    // are swapped or relocated one by one, and a heap block is allocated only
+    // for elements that fit in no free inline buffer.
+    template <typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::swap(Vector &vector){
+        if constexpr (alloc_traits::propagate_on_container_swap::value){
+            std::swap(this->m_alloc, vector.m_alloc);
+        }
+        bool mine_inline = is_inline(m_data), theirs_inline = vector.is_inline(vector.m_data);
+        if (!mine_inline && !theirs_inline){
+            std::swap(this->m_size, vector.m_size);
+            std::swap(this->m_capacity, vector.m_capacity);
+            std::swap(this->m_data, vector.m_data);
+            return;
+        }
+        if (mine_inline && theirs_inline && m_size <= vector.m_inline->capacity && vector.m_size <= m_inline->capacity){
+            swap_inline(vector);
+            return;
+        }
+        // the side whose inline elements move out first: the inline one, or the larger of two
+        if (!theirs_inline || (mine_inline && m_size >= vector.m_size)){
+            trade_storage(vector);
+        } else {
+            vector.trade_storage(*this);
+        }
+    }
+
+    // private function, both hold their elements inline and each fits into
+    // the buffer of the other: the common part is swapped, the rest relocated
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::swap_inline(Vector &other){
+        Vector &small = m_size <= other.m_size ? *this : other;
+        Vector &large = &small == this ? other : *this;
+        std::swap_ranges(small.m_data, small.m_data + small.m_size, large.m_data);
+        recorder::moved(3 * small.m_size);
+        small.relocate(large.m_data + small.m_size, large.m_size - small.m_size, small.m_data + small.m_size);
+        std::swap(m_size, other.m_size);
+    }
+
+    // private function, *this holds its elements inline. They move to the free
+    // inline buffer of other or to a new block, then *this takes the heap block
+    // of other or relocates its elements. All storage is obtained before any
+    // element moves; an element copy throwing in the second step leaves other
+    // with the elements of *this and *this empty.
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::trade_storage(Vector &other){
+        const std::size_t size = m_size, other_size = other.m_size;
+        T *other_data = other.m_data;
+        const std::size_t other_capacity = other.m_capacity;
+        const bool other_inline = other.is_inline(other_data);
+        const bool adopt = !other_inline && (alloc_traits::is_always_equal::value || m_alloc == other.m_alloc);
+
+        T *target = nullptr;
+        std::size_t target_capacity = size;
+        if (other.m_inline && !other_inline && size <= other.m_inline->capacity){
+            target = other.m_inline->data;
+            target_capacity = other.m_inline->capacity;
+        } else {
+            target_capacity = size ? Growth::template reserve_capacity<T>(0, size) : 0;
+            target = other.allocate(target_capacity);
+        }
+        T *mine = nullptr;
+        std::size_t mine_capacity = 0;
+        if (!adopt){
+            try {
+                mine_capacity = other_size <= m_inline->capacity ? m_inline->capacity : Growth::template reserve_capacity<T>(0, other_size);
+                mine = other_size <= m_inline->capacity ? m_inline->data : allocate(mine_capacity);
+            } catch (...) {
+                other.deallocate(target, target_capacity);
+                throw;
+            }
         }
+
+        try {
+            other.relocate(m_data, size, target);
+        } catch (...) {
+            other.deallocate(target, target_capacity);
+            deallocate(mine, mine_capacity);
+            throw;
+        }
+        other.m_data = target;
+        other.m_capacity = target_capacity;
+        other.m_size = size;
+        m_size = 0;
+        if (adopt){
+            m_data = other_data;
+            m_capacity = other_capacity;
+        } else {
+            m_data = mine;
+            m_capacity = mine_capacity;
+            try {
+                relocate(other_data, other_size, mine);
+            } catch (...) {
+                other.destroy(other_data, other_data + other_size);
+                other.deallocate(other_data, other_capacity);
+                throw;
+            }
+            other.deallocate(other_data, other_capacity);
+        }
+        m_size = other_size;
     }
 
-    template <typename T>
-    void Vector<T>::swap(Vector &vector) noexcept{
-        std::swap(this->m_size, vector.m_size);
-        std::swap(this->m_capacity, vector.m_capacity);
-        std::swap(this->m_data, vector.m_data);
+    // assigns value to every element
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::fill(const T &value){
+        simd::fill<T>(m_data, m_data + m_size, value);
     }
 
     //------------------- Operations -----------------------//
-    template<typename T>
-	std::string Vector<T>::toString(const std::string &name) const {
-        std::stringstream stream;
-        stream << "\n<===== Vector: " << name << " ======>\n >>Size:" << m_size;
-		std::size_t index = 0;
-		for (const auto &it : *this) {
-			stream << "\n [" << index << "]=> " << it ;
-			index++;
-		}
-		stream << "\n<=== End " << name << " ====>\n";
-        return stream.str();
+    template<typename T, typename Allocator, typename Growth>
+	std::string Vector<T, Allocator, Growth>::toString(const std::string &name) const {
+        return toString(name, Summary());
 	}
 
-    template<typename T>
-    bool Vector<T>::operator==(const Vector<T>& other) const{
+    template<typename T, typename Allocator, typename Growth>
+    std::string Vector<T, Allocator, Growth>::toString(const std::string &name, const Summary &summary) const {
+        Text_buffer buffer(table_capacity(name, m_size, summary));
+        format_to(buffer, name, summary);
+        return buffer.take();
+    }
+
+    // appends the toString text to buffer, which can be reused across dumps
+    template<typename T, typename Allocator, typename Growth>
+    void Vector<T, Allocator, Growth>::format_to(Text_buffer &buffer, const std::string &name, const Summary &summary) const {
+        format_table(buffer, "Vector", name, cbegin(), m_size, summary);
+    }
+
+    // The searches run the kernels of Simd.hpp: arithmetic elements are
+    // compared a vector register at a time, others as std::find etc. would
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::find(const T &value){
+        return iterator(const_cast<T *>(simd::find<T>(m_data, m_data + m_size, value)));
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::const_iterator Vector<T, Allocator, Growth>::find(const T &value) const {
+        return const_iterator(const_cast<T *>(simd::find<T>(m_data, m_data + m_size, value)));
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    std::size_t Vector<T, Allocator, Growth>::count(const T &value) const {
+        return simd::count<T>(m_data, m_data + m_size, value);
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    bool Vector<T, Allocator, Growth>::contains(const T &value) const {
+        return find(value) != end();
+    }
+
+    // first smallest element, end() when empty
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::min_element(){
+        return iterator(const_cast<T *>(simd::min_element<T>(m_data, m_data + m_size)));
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::const_iterator Vector<T, Allocator, Growth>::min_element() const {
+        return const_iterator(const_cast<T *>(simd::min_element<T>(m_data, m_data + m_size)));
+    }
+
+    // first greatest element, end() when empty
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::max_element(){
+        return iterator(const_cast<T *>(simd::max_element<T>(m_data, m_data + m_size)));
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::const_iterator Vector<T, Allocator, Growth>::max_element() const {
+        return const_iterator(const_cast<T *>(simd::max_element<T>(m_data, m_data + m_size)));
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    bool Vector<T, Allocator, Growth>::operator==(const Vector& other) const{
         if (m_size != other.size()){
             return false;
         }
-        return std::equal(m_data, m_data + m_size, other.m_data);
+        return simd::equal<T>(m_data, m_data + m_size, other.m_data);
     }
 
-    template<typename T>
-    bool Vector<T>::operator!=(const Vector<T>& other) const{
+    template<typename T, typename Allocator, typename Growth>
+    bool Vector<T, Allocator, Growth>::operator!=(const Vector& other) const{
         return !(operator==(other));
     }
 
 
 	//---------------- Non-member functions ----------------//
-	template<typename T>
-	std::ostream& operator<<(std::ostream& os, const Vector<T> & vector) {
-		// for (const auto &it : vector) {
-		// 	os << it << "->";
-		// }
-        for (std::size_t i = 0 ; i < vector.size(); ++i) {
-			os << vector[i] << ", ";
-		}
-
-        os << "END";
-            return os;
+	template<typename T, typename Allocator, typename Growth>
+	std::ostream& operator<<(std::ostream& os, const Vector<T, Allocator, Growth> & vector) {
+        return format_inline(os, vector.cbegin(), vector.size(), ", ", "END");
 	}
 
 	//-------------- Inner class const_iterator --------//
-    template<class T>
-    class Vector<T>::const_iterator {
+    // Contiguous random-access iterator, usable with the std algorithms
+    template<class T, class Allocator, class Growth>
+    class Vector<T, Allocator, Growth>::const_iterator {
     public:
+        using iterator_category = std::random_access_iterator_tag;
+#if __cplusplus >= 202002L
+        using iterator_concept = std::contiguous_iterator_tag;
+#endif
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
         const_iterator();
 
         const_iterator& operator++();
         const_iterator operator++(int);
         const_iterator& operator--();
         const_iterator operator--(int);
+        const_iterator& operator+=(difference_type offset);
+        const_iterator& operator-=(difference_type offset);
+        const_iterator operator+(difference_type offset) const;
+        const_iterator operator-(difference_type offset) const;
+        friend const_iterator operator+(difference_type offset, const const_iterator &it) { return it + offset; }
 
-        T& operator*();
+        const T& operator*() const;
+        const T* operator->() const;
+        const T& operator[](difference_type offset) const;
 
         bool operator==(const const_iterator& other) const;
         bool operator!=(const const_iterator& other) const;
-        std::ptrdiff_t operator-(const const_iterator& other) const;
+        bool operator<(const const_iterator& other) const;
+        bool operator>(const const_iterator& other) const;
+        bool operator<=(const const_iterator& other) const;
+        bool operator>=(const const_iterator& other) const;
+        difference_type operator-(const const_iterator& other) const;
 
     protected:
         T* m_current; // member
 
         const_iterator(T *new_ptr); // constructor
 		T &get() const; // get the value at the iterator current position
-		friend class Vector<T>;
+		friend class Vector<T, Allocator, Growth>;
     };
 
     //------------------- Inner class iterator ------------------//
-	template <typename T>
-	class Vector<T>::iterator final: public const_iterator {
+	template <typename T, typename Allocator, typename Growth>
+	class Vector<T, Allocator, Growth>::iterator final: public const_iterator {
 	public:
+        using typename const_iterator::difference_type;
+        using pointer = T*;
+        using reference = T&;
+
 		iterator();
 
-		T &operator*();
-		const T &operator*() const;
+		T &operator*() const;
+		T *operator->() const;
+		T &operator[](difference_type offset) const;
 
 		iterator &operator++();
 		iterator operator++(int);
 		iterator &operator--();
 		iterator operator--(int);
+		iterator &operator+=(difference_type offset);
+		iterator &operator-=(difference_type offset);
+		iterator operator+(difference_type offset) const;
+		iterator operator-(difference_type offset) const;
+		using const_iterator::operator-; // distance between iterators
+		friend iterator operator+(difference_type offset, const iterator &it) { return it + offset; }
 
 	private:
 		iterator(T *new_ptr); // constructor
-		friend class Vector<T>;
+		friend class Vector<T, Allocator, Growth>;
 	};
 
     //-------------- class const_iterator implementation--------//
-    template<typename T>
-    Vector<T>::const_iterator::const_iterator() :m_current{nullptr} {}
+    template<typename T, typename Allocator, typename Growth>
+    Vector<T, Allocator, Growth>::const_iterator::const_iterator() :m_current{nullptr} {}
 
     //protected constructor
-	template <typename T>
-	Vector<T>::const_iterator::const_iterator(T *new_ptr) :m_current{new_ptr} {}
+	template <typename T, typename Allocator, typename Growth>
+	Vector<T, Allocator, Growth>::const_iterator::const_iterator(T *new_ptr) :m_current{new_ptr} {}
 
-    template<typename T>
-    typename Vector<T>::const_iterator &Vector<T>::const_iterator::operator++(){
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::const_iterator &Vector<T, Allocator, Growth>::const_iterator::operator++(){
         ++m_current;
         return *this;
     }
 
-    template<typename T>
-    typename Vector<T>::const_iterator Vector<T>::const_iterator::operator++(int){
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::const_iterator Vector<T, Allocator, Growth>::const_iterator::operator++(int){
         const_iterator temp = m_current;
         ++m_current;
         return temp;
     }
 
-    template<typename T>
-    typename Vector<T>::const_iterator &Vector<T>::const_iterator::operator--(){
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::const_iterator &Vector<T, Allocator, Growth>::const_iterator::operator--(){
         --m_current;
         return *this;
     }
 
-    template<typename T>
-    typename Vector<T>::const_iterator Vector<T>::const_iterator::operator--(int){
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::const_iterator Vector<T, Allocator, Growth>::const_iterator::operator--(int){
         const_iterator temp = m_current;
         --m_current;
         return temp;
     }
 
-    template<typename T>
-    T& Vector<T>::const_iterator::operator*(){
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::const_iterator &Vector<T, Allocator, Growth>::const_iterator::operator+=(difference_type offset){
+        m_current += offset;
+        return *this;
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::const_iterator &Vector<T, Allocator, Growth>::const_iterator::operator-=(difference_type offset){
+        m_current -= offset;
+        return *this;
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::const_iterator Vector<T, Allocator, Growth>::const_iterator::operator+(difference_type offset) const {
+        return const_iterator(m_current + offset);
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::const_iterator Vector<T, Allocator, Growth>::const_iterator::operator-(difference_type offset) const {
+        return const_iterator(m_current - offset);
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    const T& Vector<T, Allocator, Growth>::const_iterator::operator*() const {
         return get();
     }
 
+    template<typename T, typename Allocator, typename Growth>
+    const T* Vector<T, Allocator, Growth>::const_iterator::operator->() const {
+        return m_current;
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    const T& Vector<T, Allocator, Growth>::const_iterator::operator[](difference_type offset) const {
+        return m_current[offset];
+    }
+
     // protected member function
-    template<typename T>
-    T &Vector<T>::const_iterator::get() const {
+    template<typename T, typename Allocator, typename Growth>
+    T &Vector<T, Allocator, Growth>::const_iterator::get() const {
         return *m_current;
     }
 
-    template<typename T>
-    bool Vector<T>::const_iterator::operator==(const const_iterator &other) const {
+    template<typename T, typename Allocator, typename Growth>
+    bool Vector<T, Allocator, Growth>::const_iterator::operator==(const const_iterator &other) const {
         return this->m_current == other.m_current;
     }
 
-    template<typename T>
-    bool Vector<T>::const_iterator::operator!=(const const_iterator &other) const {
+    template<typename T, typename Allocator, typename Growth>
+    bool Vector<T, Allocator, Growth>::const_iterator::operator!=(const const_iterator &other) const {
         return !(*this == other);
     }
-    template<typename T>
-    std::ptrdiff_t Vector<T>::const_iterator::operator-(const const_iterator &other) const {
-        return this->m_current == other.m_current;
+
+    template<typename T, typename Allocator, typename Growth>
+    bool Vector<T, Allocator, Growth>::const_iterator::operator<(const const_iterator &other) const {
+        return this->m_current < other.m_current;
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    bool Vector<T, Allocator, Growth>::const_iterator::operator>(const const_iterator &other) const {
+        return other < *this;
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    bool Vector<T, Allocator, Growth>::const_iterator::operator<=(const const_iterator &other) const {
+        return !(other < *this);
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    bool Vector<T, Allocator, Growth>::const_iterator::operator>=(const const_iterator &other) const {
+        return !(*this < other);
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::const_iterator::difference_type
+    Vector<T, Allocator, Growth>::const_iterator::operator-(const const_iterator &other) const {
+        return this->m_current - other.m_current;
     }
 
     //-------------- class iterator implementation--------//
-    template<typename T>
-    Vector<T>::iterator::iterator() :const_iterator{}{}
+    template<typename T, typename Allocator, typename Growth>
+    Vector<T, Allocator, Growth>::iterator::iterator() :const_iterator{}{}
 
     //protected constructor
-	template <typename T>
-	Vector<T>::iterator::iterator(T *new_ptr) :const_iterator{new_ptr} {}
+	template <typename T, typename Allocator, typename Growth>
+	Vector<T, Allocator, Growth>::iterator::iterator(T *new_ptr) :const_iterator{new_ptr} {}
 
-     template<typename T>
-    typename Vector<T>::iterator &Vector<T>::iterator::operator++(){
+     template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator &Vector<T, Allocator, Growth>::iterator::operator++(){
         ++(this->m_current);
         return *this;
     }
 
-    template<typename T>
-    typename Vector<T>::iterator Vector<T>::iterator::operator++(int){
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::iterator::operator++(int){
         iterator temp = this->m_current;
          ++(this->m_current);
         return temp;
     }
 
-    template<typename T>
-    typename Vector<T>::iterator &Vector<T>::iterator::operator--(){
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator &Vector<T, Allocator, Growth>::iterator::operator--(){
         --(this->m_current);
         return *this;
     }
 
-    template<typename T>
-    typename Vector<T>::iterator Vector<T>::iterator::operator--(int){
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::iterator::operator--(int){
         iterator temp = this->m_current;
         --(this->m_current);
         return temp;
     }
 
-	template <typename T>
-	const T &Vector<T>::iterator::operator*() const {
-		return const_iterator::operator*();
-	}
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator &Vector<T, Allocator, Growth>::iterator::operator+=(difference_type offset){
+        this->m_current += offset;
+        return *this;
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator &Vector<T, Allocator, Growth>::iterator::operator-=(difference_type offset){
+        this->m_current -= offset;
+        return *this;
+    }
 
-	template <typename T>
-	T &Vector<T>::iterator::operator*() {
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::iterator::operator+(difference_type offset) const {
+        return iterator(this->m_current + offset);
+    }
+
+    template<typename T, typename Allocator, typename Growth>
+    typename Vector<T, Allocator, Growth>::iterator Vector<T, Allocator, Growth>::iterator::operator-(difference_type offset) const {
+        return iterator(this->m_current - offset);
+    }
+
+	template <typename T, typename Allocator, typename Growth>
+	T &Vector<T, Allocator, Growth>::iterator::operator*() const {
 		return const_iterator::get();
 	}
 
+	template <typename T, typename Allocator, typename Growth>
+	T *Vector<T, Allocator, Growth>::iterator::operator->() const {
+		return this->m_current;
+	}
+
+	template <typename T, typename Allocator, typename Growth>
+	T &Vector<T, Allocator, Growth>::iterator::operator[](difference_type offset) const {
+		return this->m_current[offset];
+	}
+
 } // namespace container
@@ -0,0 +1,82 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "ConcurrentForwardList.hpp"
+
+int main(){
+    // 1. creating a container object that several threads may use at once
+    container::ConcurrentForwardList<int> concurrent_list {1,2,3,4,5};
+
+    // 2. displaying the contents of the container on the screen
+        // expected result: 1->2->3->4->5->NULL
+    std::cout << concurrent_list << std::endl;
+
+    // 3. erasing after and inserting after an element, iterators need a guard
+    {
+        auto guard = concurrent_list.pin();
+        auto second = ++concurrent_list.begin();
+        concurrent_list.erase_after(second);
+        concurrent_list.insert_after(second, 30);
+    }
+    concurrent_list.push_front(0);
+        // expected result: 0->1->2->30->4->5->NULL
+    std::cout << concurrent_list << std::endl;
+
+    // 4. stress: four threads push 25000 elements each while reading the list
+    concurrent_list.clear();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t){
+        threads.emplace_back([&concurrent_list, t]{
+            for (int i = 0; i < 25000; ++i){
+                concurrent_list.push_front(t * 25000 + i);
+                if (i % 1000 == 0){
+                    concurrent_list.contains(-1);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads){
+        thread.join();
+    }
+        // expected result: 100000 4999950000
+    long long sum = 0;
+    {
+        auto guard = concurrent_list.pin();
+        for (const auto &element : concurrent_list){
+            sum += element;
+        }
+    }
+    std::cout << concurrent_list.size() << " " << sum << std::endl;
+
+    // 5. stress: four threads take the elements out again while inserting
+    // temporary -1 elements, every element is taken exactly once
+    threads.clear();
+    std::vector<long long> sums(4, 0);
+    for (int t = 0; t < 4; ++t){
+        threads.emplace_back([&concurrent_list, &sums, t]{
+            int element = 0;
+            while (concurrent_list.pop_front(element)){
+                if (element < 0){
+                    continue;
+                }
+                sums[t] += element;
+                auto guard = concurrent_list.pin();
+                auto first = concurrent_list.begin();
+                if (first != concurrent_list.end()){
+                    concurrent_list.insert_after(first, -1);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads){
+        thread.join();
+    }
+        // expected result: 1 4999950000
+    std::cout << concurrent_list.empty() << " " << sums[0] + sums[1] + sums[2] + sums[3] << std::endl;
+
+    concurrent_list.push_front(7);
+    concurrent_list.push_front(8);
+    std::cout << concurrent_list.toString("concurrent_list");
+
+    return 0;
+}
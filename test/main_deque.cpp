@@ -0,0 +1,54 @@
+#include <iostream>
+#include "Deque.hpp"
+
+int main(){
+    // 1. creating a container object to store objects of type int
+    // 2. adding ten elements to the container (0, 1 ... 9)
+    container::Deque<int> deque {0,1,2,3,4,5,6,7,8,9};
+
+    // 3. displaying the contents of the container on the screen
+        // expected result: 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, END
+    std::cout << deque << std::endl;
+
+    // 4. display the container size on the screen
+        // expected result: 10
+    std::cout << deque.size() << std::endl;
+
+    // 5. adding elements at both ends
+    deque.push_front(10);
+    deque.push_back(20);
+        // expected result: 10, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 20, END
+    std::cout << deque << std::endl;
+
+    // 6. references stay valid while elements are added at the ends
+    const int &first = deque.front();
+    for (int i = 0; i < 10000; ++i){
+        deque.push_front(i);
+        deque.push_back(i);
+    }
+        // expected result: 10 10
+    std::cout << first << " " << deque[10000] << std::endl;
+
+    // 7. removing elements from both ends
+    for (int i = 0; i < 10000; ++i){
+        deque.pop_front();
+        deque.pop_back();
+    }
+    deque.pop_front();
+    deque.pop_back();
+        // expected result: 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, END
+    std::cout << deque << std::endl;
+
+    // 8. random-access iterators
+    auto iter = deque.begin() + 3;
+        // expected result: 3 7 10
+    std::cout << *iter << " " << iter[4] << " " << deque.end() - deque.begin() << std::endl;
+
+    for (auto iter = deque.begin(); iter != deque.end(); ++iter) {
+        std::cout << *iter << std::endl;
+    }
+
+    std::cout << deque.toString("deque");
+
+    return 0;
+}
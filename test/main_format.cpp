@@ -0,0 +1,60 @@
+#include <iostream>
+#include <string>
+#include "Vector.hpp"
+#include "List.hpp"
+#include "Forward_list.hpp"
+
+int main(){
+    // 1. creating containers
+    container::Vector<double> prices{1.5, 2.25, 0.1, 100000, 1e-7};
+    container::List<int> ids;
+    container::Forward_list<std::string> names{"ada", "grace"};
+    for (int i = 0; i < 100; ++i) {
+        ids.push_back(i * i);
+    }
+
+    // 2. printing them as before
+        // expected result: 1.5, 2.25, 0.1, 100000, 1e-07, END
+    std::cout << prices << std::endl;
+        // expected result: ada->grace->NULL
+    std::cout << names << std::endl;
+
+    // 3. dumping the first 2 and last 1 elements of a long List
+        // expected result:
+        // <===== List: ids ======>
+        //  >>Size:100
+        //  [0]=> 0
+        //  [1]=> 1
+        //  ... 97 more
+        //  [99]=> 9801
+        // <=== End ids ====>
+    std::cout << ids.toString("ids", container::Summary{2, 1});
+
+    // 4. reusing one buffer for several dumps
+    container::Text_buffer buffer;
+    prices.format_to(buffer, "prices", container::Summary{1, 0});
+        // expected result: 86
+    std::cout << buffer.view().size() << std::endl;
+    buffer.clear();
+    names.format_to(buffer, "names");
+        // expected result:
+        // <===== Forward List: names ======>
+        //  [0]=> ada
+        //  [1]=> grace
+        // <=== End names ====>
+    std::cout << buffer.view();
+
+    // 5. sending a dump to a sink as the buffer fills up
+    std::size_t chunks = 0;
+    std::string sunk;
+    container::Text_buffer sink([&](const char *text, std::size_t count){
+        ++chunks;
+        sunk.append(text, count);
+    }, 64);
+    ids.format_to(sink, "ids");
+    sink.flush();
+        // expected result: 1
+    std::cout << (sunk == ids.toString("ids") && chunks > 1) << std::endl;
+
+    return 0;
+}
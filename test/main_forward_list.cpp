@@ -1,5 +1,13 @@
 #include "Forward_list.hpp"
 
+// can be neither copied nor moved, so it can only be constructed in place
+struct Pinned {
+    Pinned(int first, int second) :sum{first + second} {}
+    Pinned(const Pinned &) = delete;
+    Pinned &operator=(const Pinned &) = delete;
+    int sum;
+};
+
 int main(){
     // 1. creating a container object to store objects of type int
     // 2. adding ten elements to the container (0, 1 ... 9)
@@ -44,6 +52,30 @@ int main(){
         // expected result: 10, 0, 1, 3, 20, 5, 7, 8, 9, 30
     std::cout << simple_list << std::endl;
 
+    // 13. sorting the container, dropping the odd elements and reversing it in place
+    simple_list.sort();
+    simple_list.remove_if([](int value){ return value % 2 != 0; });
+    simple_list.reverse();
+        // expected result: 30, 20, 10, 8, 0
+    std::cout << simple_list << std::endl;
+
+    // 14. moving the nodes of another list after the first element
+    container::Forward_list<int> other_list {1, 2};
+    simple_list.splice_after(simple_list.begin(), other_list);
+        // expected result: 30, 1, 2, 20, 10, 8, 0
+    std::cout << simple_list << std::endl;
+
+    // 15. constructing elements in place, at the ends and after a position
+    container::Forward_list<Pinned> pinned;
+    pinned.emplace_front(1, 2);
+    pinned.emplace_back(3, 4);
+    pinned.emplace_after(pinned.begin(), 5, 6);
+        // expected result: 3 11 7
+    for (const auto &element : pinned) {
+        std::cout << element.sum << " ";
+    }
+    std::cout << std::endl;
+
     // Additional task 4. Implement an additional structure - an iterator, 
     // encapsulating the logic for traversing the container
     // Example code that should work once implemented:
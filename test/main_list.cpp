@@ -1,6 +1,14 @@
 #include <iostream>
 #include "List.hpp"
 
+// can be neither copied nor moved, so it can only be constructed in place
+struct Pinned {
+    Pinned(int first, int second) :sum{first + second} {}
+    Pinned(const Pinned &) = delete;
+    Pinned &operator=(const Pinned &) = delete;
+    int sum;
+};
+
 int main(){
     // 1. creating a container object to store objects of type int
     // 2. adding ten elements to the container (0, 1 ... 9)
@@ -41,6 +49,48 @@ int main(){
         // expected result: 10, 0, 1, 3, 20, 5, 7, 8, 9, 30
     std::cout << double_linked_list<< std::endl;
 
+    // 13. sorting the container, then moving the nodes of another sorted list into it
+    double_linked_list.sort();
+    container::List<int> other_list {2, 4, 6};
+    double_linked_list.merge(other_list);
+        // expected result: 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 20, 30
+    std::cout << double_linked_list<< std::endl;
+
+    // 14. reversing the container in place
+    double_linked_list.reverse();
+        // expected result: 30, 20, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+    std::cout << double_linked_list<< std::endl;
+
+    // 15. constructing elements in place, at the ends and before a position
+    container::List<Pinned> pinned;
+    pinned.emplace_back(1, 2);
+    pinned.emplace_front(3, 4);
+    pinned.emplace(++pinned.begin(), 5, 6);
+        // expected result: 7 11 3
+    for (const auto &element : pinned) {
+        std::cout << element.sum << " ";
+    }
+    std::cout << std::endl;
+
+    // 16. indexed reads stay correct while the list changes between them
+    container::List<int> indexed_list {0,1,2,3,4,5,6,7,8,9};
+    std::cout << indexed_list[7] << " ";
+    indexed_list.erase(3);
+    std::cout << indexed_list[6] << " ";
+    indexed_list.insert(indexed_list.begin(), 100);
+    std::cout << indexed_list[7] << " ";
+    indexed_list.push_mid(50);
+    std::cout << indexed_list[5] << " " << indexed_list[10] << " ";
+    indexed_list.reverse();
+    std::cout << indexed_list[2] << " " << indexed_list[5] << " " << indexed_list[8] << " ";
+    container::List<int> spliced_list {-1, -2};
+    indexed_list.splice(indexed_list.begin(), spliced_list);
+    std::cout << indexed_list[10] << " " << indexed_list[12] << " ";
+    indexed_list.sort();
+    const auto &const_list = indexed_list;
+        // expected result: 7 7 7 50 9 7 50 1 1 100 1 50 -2
+    std::cout << const_list[3] << " " << const_list[11] << " " << indexed_list[0] << std::endl;
+
     // Additional task 4. Implement an additional structure - an iterator, 
     // encapsulating the logic for traversing the container
     // Example code that should work once implemented:
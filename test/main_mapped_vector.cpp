@@ -0,0 +1,63 @@
+#include <cstdio>
+#include <iostream>
+#include <limits>
+#include "MappedVector.hpp"
+
+int main(){
+    const char *path = "main_mapped_vector.bin";
+    std::remove(path);
+
+    {
+        // 1. creating a container backed by a new file
+        container::MappedVector<int> vec(path);
+
+        // 2. adding elements 0 ... 9 to the container
+        for (int i = 0; i < 10; ++i){
+            vec.push_back(i);
+        }
+
+        // 3. inserting element 20 in the middle and erasing the first element
+        vec.insert(vec.size() / 2, 20);
+        vec.erase(vec.begin());
+
+        // 4. displaying the contents of the container on the screen
+            // expected result: 1, 2, 3, 4, 20, 5, 6, 7, 8, 9, END
+        std::cout << vec << std::endl;
+
+        // 5. writing the pages to the file before closing it
+        vec.flush();
+    }
+
+    {
+        // 6. opening the file again, the elements are mapped, not read
+        container::MappedVector<int> vec(path);
+            // expected result: 10 20 9
+        std::cout << vec.size() << " " << vec[4] << " " << vec.at(9) << std::endl;
+
+        // 7. growing the file past its first page
+        vec.reserve(5000);
+            // expected result: 1
+        std::cout << (vec.capacity() >= 5000) << std::endl;
+
+        // 8. a capacity whose file size would overflow is refused before the file changes
+        const std::size_t capacity = vec.capacity();
+        try {
+            vec.reserve(std::numeric_limits<std::size_t>::max() / 2);
+        } catch (const std::length_error &) {
+                // expected result: too large 1
+            std::cout << "too large " << (vec.capacity() == capacity) << std::endl;
+        }
+        std::cout << vec.toString("vec");
+    }
+
+    // 9. opening the file as another element type fails
+    try {
+        container::MappedVector<double> wrong(path);
+    } catch (const std::runtime_error &error) {
+            // expected result: ERROR: MappedVector element size or count does not match main_mapped_vector.bin
+        std::cout << error.what() << std::endl;
+    }
+
+    std::remove(path);
+    return 0;
+}
@@ -0,0 +1,39 @@
+#include <iostream>
+#include "List.hpp"
+#include "Forward_list.hpp"
+#include "Node_pool.hpp"
+
+int main(){
+    // 1. a list owning its node pool
+    container::List<int, container::Pool_allocator<int>> pooled_list {0,1,2,3,4,5,6,7,8,9};
+    auto pool = pooled_list.get_allocator().pool();
+
+    // 2. displaying the contents of the container on the screen
+        // expected result: 0->1->2->3->4->5->6->7->8->9->NULL
+    std::cout << pooled_list << std::endl;
+
+    // 3. erased nodes are recycled, no new chunk is needed to insert again
+        // expected result: 11 live blocks (10 elements + end node) in 2 chunks
+    pooled_list.erase(std::size_t{3});
+    pooled_list.push_back(10);
+    std::cout << pool->live_blocks() << " live blocks in " << pool->chunk_count() << " chunks" << std::endl;
+
+    // 4. clear() gives the chunks back, only the end node stays allocated
+        // expected result: 1 live blocks in 1 chunks
+    pooled_list.clear();
+    std::cout << pool->live_blocks() << " live blocks in " << pool->chunk_count() << " chunks" << std::endl;
+
+    // 5. two forward lists sharing one pool
+    auto shared_pool = std::make_shared<container::Node_pool>();
+    container::Pool_allocator<int> allocator{shared_pool};
+    container::Forward_list<int, container::Pool_allocator<int>> first {{1,2,3}, allocator};
+    container::Forward_list<int, container::Pool_allocator<int>> second {{4,5}, allocator};
+        // expected result: 5 live blocks
+    std::cout << shared_pool->live_blocks() << " live blocks" << std::endl;
+
+    first.push_front(0);
+    second.pop_front();
+    std::cout << first.toString("first") << second.toString("second");
+
+    return 0;
+}
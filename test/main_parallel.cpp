@@ -0,0 +1,45 @@
+#include <iostream>
+#include "Parallel.hpp"
+
+int main(){
+    // 1. creating a container object with 100000 elements (1, 2 ... 100000)
+    container::Vector<long> vector;
+    for (long i = 1; i <= 100000; ++i){
+        vector.push_back(i);
+    }
+
+    // 2. a pool with three workers, chunks of 10000 elements
+    container::parallel::Thread_pool pool(3);
+    container::parallel::Options options;
+    options.pool = &pool;
+    options.grain = 10000;
+
+    // 3. summing the elements
+        // expected result: 5000050000
+    std::cout << container::parallel::reduce(vector, 0L, std::plus<>(), options) << std::endl;
+
+    // 4. counting and finding elements
+        // expected result: 14285 70
+    std::cout << container::parallel::count_if(vector, [](long x){ return x % 7 == 0; }, options) << " "
+              << *container::parallel::find_if(vector, [](long x){ return x % 70 == 0; }, options) << std::endl;
+
+    // 5. squaring the elements into another container, then negating them in place
+    container::Vector<long> squares;
+    container::parallel::transform(vector, squares, [](long x){ return x * x; }, options);
+    container::parallel::for_each(squares, [](long &x){ x = -x; }, options);
+        // expected result: 100000 -1 -10000000000
+    std::cout << squares.size() << " " << squares[0] << " " << squares[99999] << std::endl;
+
+    // 6. sorting the elements
+    container::parallel::sort(squares, std::less<>(), options);
+        // expected result: -10000000000 -1
+    std::cout << squares[0] << " " << squares[99999] << std::endl;
+
+    // 7. small containers are processed on the calling thread
+    container::Vector<int> small {5, 3, 1, 4, 2};
+    container::parallel::sort(small);
+        // expected result: 1, 2, 3, 4, 5, END
+    std::cout << small << std::endl;
+
+    return 0;
+}
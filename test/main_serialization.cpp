@@ -0,0 +1,70 @@
+#include <cstdio>
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "Serialization.hpp"
+
+int main(){
+    const char *path = "main_serialization.bin";
+
+    // 1. creating containers of trivially copyable and of other elements
+    container::Vector<int> numbers{1, 2, 3, 4, 5};
+    container::List<std::string> words{"alpha", "beta", "gamma"};
+    container::Forward_list<container::Vector<int>> rows{{1, 2}, {}, {3}};
+
+    // 2. writing them one after the other to a file
+    int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    {
+        container::Binary_writer writer(fd);
+        container::serialize(writer, numbers);
+        container::serialize(writer, words);
+        container::serialize(writer, rows);
+        writer.flush();
+    }
+    ::close(fd);
+
+    // 3. reading them back in the same order
+    container::Vector<int> numbers_read;
+    container::List<std::string> words_read;
+    container::Forward_list<container::Vector<int>> rows_read;
+    fd = ::open(path, O_RDONLY);
+    {
+        container::Binary_reader reader(fd);
+        container::deserialize(reader, numbers_read);
+        container::deserialize(reader, words_read);
+        container::deserialize(reader, rows_read);
+    }
+    ::close(fd);
+        // expected result: 1, 2, 3, 4, 5, END
+    std::cout << numbers_read << std::endl;
+        // expected result: alpha->beta->gamma->NULL
+    std::cout << words_read << std::endl;
+        // expected result: 3 2 0 1
+    std::cout << rows_read.size() << " " << rows_read[0].size() << " " << rows_read[1].size() << " " << rows_read[2].size() << std::endl;
+
+    // 4. reading a container as another element type fails
+    fd = ::open(path, O_RDONLY);
+    try {
+        container::Binary_reader reader(fd);
+        container::Vector<double> wrong;
+        container::deserialize(reader, wrong);
+    } catch (const std::runtime_error &error) {
+            // expected result: ERROR: container binary holds another element type
+        std::cout << error.what() << std::endl;
+    }
+    ::close(fd);
+
+    // 5. viewing the first Vector in a loaded buffer without copying it
+    std::vector<long long> buffer(16);
+    FILE *file = std::fopen(path, "rb");
+    const std::size_t bytes = std::fread(buffer.data(), 1, buffer.size() * sizeof(long long), file);
+    std::fclose(file);
+    container::Vector_view<int> view(buffer.data(), bytes);
+        // expected result: 5 1 5
+    std::cout << view.size() << " " << view[0] << " " << view.at(4) << std::endl;
+
+    std::remove(path);
+    return 0;
+}
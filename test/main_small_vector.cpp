@@ -0,0 +1,67 @@
+#include <iostream>
+#include "SmallVector.hpp"
+
+int main(){
+    // 1. creating a container object keeping up to 8 ints inline
+    // 2. adding five elements to the container (0, 1 ... 4)
+    container::SmallVector<int, 8> small_vec {0,1,2,3,4};
+
+    // 3. displaying the contents of the container on the screen
+        // expected result: 0, 1, 2, 3, 4, END
+    std::cout << small_vec << std::endl;
+
+    // 4. the elements live inside the object
+        // expected result: 5 1
+    std::cout << small_vec.size() << " " << small_vec.is_small() << std::endl;
+
+    // 5. insertions and removals work as with Vector
+    small_vec.insert(small_vec.begin(), 10);
+    small_vec.erase(std::size_t{3});
+    small_vec.push_back(20);
+        // expected result: 10, 0, 1, 3, 4, 20, END
+    std::cout << small_vec << std::endl;
+
+    // 6. growing past the inline capacity spills to the heap
+    for (int i = 0; i < 5; ++i){
+        small_vec.push_back(30 + i);
+    }
+        // expected result: 11 0
+    std::cout << small_vec.size() << " " << small_vec.is_small() << std::endl;
+
+    // 7. clearing returns to the inline buffer
+    small_vec.clear();
+    small_vec.push_back(1);
+        // expected result: 1 1
+    std::cout << small_vec.size() << " " << small_vec.is_small() << std::endl;
+
+    // 8. copies and moves keep their own inline buffer
+    auto copy = small_vec;
+    auto moved = std::move(copy);
+        // expected result: 1 1
+    std::cout << (moved == small_vec) << " " << moved.is_small() << std::endl;
+
+    // 9. copy assignment and swap between inline SmallVectors stay in the inline buffers
+    container::SmallVector<int, 8> other_vec {5, 6, 7};
+    moved = other_vec;
+    other_vec.push_back(8);
+    moved.swap(other_vec);
+        // expected result: 5, 6, 7, 8, END 5, 6, 7, END 1 1
+    std::cout << moved << " " << other_vec << " " << moved.is_small() << " " << other_vec.is_small() << std::endl;
+
+    // 10. swapping with a SmallVector on the heap trades the heap block for the inline elements
+    container::SmallVector<int, 8> big_vec;
+    for (int i = 0; i < 10; ++i){
+        big_vec.push_back(i);
+    }
+    moved.swap(big_vec);
+        // expected result: 10 0 4 1
+    std::cout << moved.size() << " " << moved.is_small() << " " << big_vec.size() << " " << big_vec.is_small() << std::endl;
+
+    for (auto iter = moved.begin(); iter != moved.end(); ++iter) {
+        std::cout << *iter << std::endl;
+    }
+
+    std::cout << moved.toString("moved");
+
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include "SoaVector.hpp"
+
+int main(){
+    // 1. creating a container of (id, price, symbol) records
+    container::SoaVector<int, double, std::string> trades;
+
+    // 2. adding elements to the container
+    trades.push_back({1, 10.5, "AAA"});
+    trades.push_back({2, 20.25, "BBB"});
+    trades.emplace_back(3, 5.75, "CCC");
+
+    // 3. displaying the contents of the container on the screen
+        // expected result: (1, 10.5, AAA), (2, 20.25, BBB), (3, 5.75, CCC), END
+    std::cout << trades << std::endl;
+
+    // 4. inserting a record at the front and erasing the third one
+    trades.insert(trades.begin(), {0, 1.0, "ZZZ"});
+    trades.erase(2);
+        // expected result: (0, 1, ZZZ), (1, 10.5, AAA), (3, 5.75, CCC), END
+    std::cout << trades << std::endl;
+
+    // 5. scanning one column, the other fields are not read
+    double total = 0;
+    for (double price : trades.column<1>()) {
+        total += price;
+    }
+        // expected result: 17.25
+    std::cout << total << std::endl;
+
+    // 6. changing a field through a row proxy
+    std::get<1>(trades[0]) = 50.0;
+        // expected result: 50 ZZZ
+    std::cout << std::get<1>(trades[0]) << " " << std::get<2>(trades.at(0)) << std::endl;
+
+    // 7. sorting the rows by price, the proxies swap every field
+    std::sort(trades.begin(), trades.end(), [](const auto &a, const auto &b){
+        return std::get<1>(a) < std::get<1>(b);
+    });
+        // expected result: (3, 5.75, CCC), (1, 10.5, AAA), (0, 50, ZZZ), END
+    std::cout << trades << std::endl;
+
+    std::cout << trades.toString("trades");
+
+    return 0;
+}
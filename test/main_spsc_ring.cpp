@@ -0,0 +1,74 @@
+#include <iostream>
+#include <limits>
+#include <thread>
+#include "SpscRing.hpp"
+
+int main(){
+    // 1. creating a ring for up to 6 ints, the capacity is rounded up to 8
+    container::SpscRing<int> ring(6);
+        // expected result: 8 0
+    std::cout << ring.capacity() << " " << ring.size() << std::endl;
+
+    // 2. adding elements until the ring is full
+    int value = 0;
+    while (ring.try_push(value)){
+        ++value;
+    }
+        // expected result: 0, 1, 2, 3, 4, 5, 6, 7, END
+    std::cout << ring << std::endl;
+
+    // 3. taking the oldest elements out, one and then three at once
+    int popped[3];
+    ring.try_pop(value);
+    ring.pop_n(popped, 3);
+        // expected result: 0 1 2 3
+    std::cout << value << " " << popped[0] << " " << popped[1] << " " << popped[2] << std::endl;
+
+    // 4. adding several elements at once, only as many as fit are added
+    int pushed[] {10, 20, 30, 40, 50, 60};
+        // expected result: 4
+    std::cout << ring.push_n(pushed, 6) << std::endl;
+        // expected result: 4, 5, 6, 7, 10, 20, 30, 40, END
+    std::cout << ring << std::endl;
+
+    // 5. passing elements from a producer thread to a consumer thread
+    container::SpscRing<long> queue(64);
+    long sum = 0;
+    std::thread consumer([&]{
+        long element = 0;
+        for (long received = 0; received < 100000;){
+            if (queue.try_pop(element)){
+                sum += element;
+                ++received;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+    for (long element = 0; element < 100000;){
+        if (queue.try_push(element)){
+            ++element;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    consumer.join();
+        // expected result: 4999950000
+    std::cout << sum << std::endl;
+
+    // 6. a capacity with no power of two in std::size_t is refused
+    try {
+        container::SpscRing<char> huge(std::numeric_limits<std::size_t>::max());
+    } catch (const std::length_error &error) {
+            // expected result: ERROR: SpscRing capacity is too large
+        std::cout << error.what() << std::endl;
+    }
+
+    for (auto iter = ring.begin(); iter != ring.end(); ++iter) {
+        std::cout << *iter << std::endl;
+    }
+
+    std::cout << ring.toString("ring");
+
+    return 0;
+}
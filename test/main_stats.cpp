@@ -0,0 +1,68 @@
+// the counters are compiled in for the whole program, before any container header
+#define CONTAINER_STATS
+
+#include <iostream>
+#include <string>
+#include "Vector.hpp"
+#include "List.hpp"
+#include "Forward_list.hpp"
+
+using container::stats::Snapshot;
+
+int main(){
+    // 1. growing a Vector one element at a time, then with reserve
+    {
+        container::Vector<std::string> words;
+        for (int i = 0; i < 20; ++i) {
+            words.push_back(std::string(1, static_cast<char>('a' + i)));
+        }
+    }
+    Snapshot grown = container::stats::snapshot<container::Vector<std::string>>();
+        // expected result: 3 2 35 20
+    std::cout << grown.allocations << " " << grown.reallocations << " " << grown.moves << " " << grown.peak_capacity << std::endl;
+
+    container::stats::reset<container::Vector<std::string>>();
+    {
+        container::Vector<std::string> words;
+        words.reserve(20);
+        for (int i = 0; i < 20; ++i) {
+            words.push_back(std::string(1, static_cast<char>('a' + i)));
+        }
+    }
+    Snapshot reserved = container::stats::snapshot<container::Vector<std::string>>();
+        // expected result: 1 0 20 20
+    std::cout << reserved.allocations << " " << reserved.reallocations << " " << reserved.moves << " " << reserved.peak_capacity << std::endl;
+
+    // 2. copying elements in and out
+    {
+        container::Vector<std::string> words{"alpha", "beta"};
+        container::Vector<std::string> copy(words);
+        std::string word = "gamma";
+        copy.push_back(word);
+    }
+    Snapshot copied = container::stats::snapshot<container::Vector<std::string>>();
+        // expected result: 5
+    std::cout << copied.copies - reserved.copies << std::endl;
+
+    // 3. indexing a List walks from the closest known node
+    container::List<int> list;
+    container::Forward_list<int> forward;
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(i);
+        forward.push_front(i);
+    }
+    long sum = 0;
+    for (std::size_t i = 0; i < 100; ++i) {
+        sum += list[i] + forward[i];
+    }
+    Snapshot list_stats = container::stats::snapshot<container::List<int>>();
+    Snapshot forward_stats = container::stats::snapshot<container::Forward_list<int>>();
+        // expected result: 9900 99 4950
+    std::cout << sum << " " << list_stats.seek_walks << " " << forward_stats.seek_walks << std::endl;
+
+    // 4. nodes: one per element, plus the end node of the List
+        // expected result: 101 100 100
+    std::cout << list_stats.allocations << " " << list_stats.peak_size << " " << forward_stats.allocations << std::endl;
+
+    return 0;
+}
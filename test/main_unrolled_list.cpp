@@ -0,0 +1,63 @@
+#include <iostream>
+#include "UnrolledList.hpp"
+
+int main(){
+    // 1. creating a container object keeping up to 4 ints per node
+    // 2. adding ten elements to the container (0, 1 ... 9)
+    container::UnrolledList<int, 4> unrolled_list {0,1,2,3,4,5,6,7,8,9};
+
+    // 3. displaying the contents of the container on the screen
+        // expected result: 0, 1, 2, 3, 4, 5, 6, 7, 8, 9
+    std::cout << unrolled_list << std::endl;
+
+    // 4. display the container size and the number of nodes on the screen
+        // expected result: 10 3
+    std::cout << unrolled_list.size() << " " << unrolled_list.node_count() << std::endl;
+
+    // 5. removal of the third (in a row), fifth and seventh elements
+    for (int index = 2, i = 0; i < 3; ++i, ++index){
+            unrolled_list.erase(index);
+    }
+    // 6. displaying the contents of the container on the screen
+        // expected result: 0, 1, 3, 5, 7, 8, 9
+    std::cout << unrolled_list << std::endl;
+
+    // 7. adding element 10 to the beginning of the container
+    unrolled_list.push_front(10);
+    // 8. displaying the contents of the container on the screen
+        // expected result: 10, 0, 1, 3, 5, 7, 8, 9
+    std::cout << unrolled_list << std::endl;
+
+    // 9. adding element 20 to the middle of the container
+    unrolled_list.push_mid(20);
+    // 10. displaying the contents of the container on the screen
+        // expected result: 10, 0, 1, 3, 20, 5, 7, 8, 9
+    std::cout << unrolled_list << std::endl;
+
+    // 11. adding element 30 to the end of the container
+    unrolled_list.push_back(30);
+    // 12. displaying the contents of the container on the screen
+        // expected result: 10, 0, 1, 3, 20, 5, 7, 8, 9, 30
+    std::cout << unrolled_list << std::endl;
+
+    // 13. removing elements drains nodes, which are merged or freed
+    while (unrolled_list.size() > 2) {
+        unrolled_list.pop_back();
+    }
+        // expected result: 10, 0 1
+    std::cout << unrolled_list << " " << unrolled_list.node_count() << std::endl;
+
+    // 14. reversing the container in place
+    unrolled_list.push_back(40);
+    unrolled_list.reverse();
+        // expected result: 40, 0, 10
+    std::cout << unrolled_list << std::endl;
+
+    for (auto iter = unrolled_list.begin(); iter != unrolled_list.end(); ++iter) {
+        std::cout << *iter << std::endl;
+    }
+
+    std::cout << unrolled_list.toString("unrolled_list");
+
+    return 0;
+}
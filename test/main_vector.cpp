@@ -1,6 +1,21 @@
+#include <algorithm>
 #include <iostream>
+#include <limits>
+#include <string>
 #include "Vector.hpp"
 
+// counts its moves, to see how often a Vector moves its elements
+struct Tracked {
+    static int moves;
+    int value;
+    explicit Tracked(int v) :value{v} {}
+    Tracked(const Tracked &other) = default;
+    Tracked(Tracked &&other) noexcept :value{other.value} { ++moves; }
+    Tracked &operator=(const Tracked &other) = default;
+    Tracked &operator=(Tracked &&other) noexcept { value = other.value; ++moves; return *this; }
+};
+int Tracked::moves = 0;
+
 int main(){
     // 1. creating a container object to store objects of type int
     // 2. adding ten elements to the container (0, 1 ... 9)
@@ -44,6 +59,111 @@ int main(){
         // expected result: 10, 0, 1, 3, 20, 5, 7, 8, 9, 30
     std::cout << vec << std::endl;
 
+    // 13. sorting the container with std::sort, its iterators are random access
+    std::sort(vec.begin(), vec.end());
+        // expected result: 0, 1, 3, 5, 7, 8, 9, 10, 20, 30
+    std::cout << vec << std::endl;
+
+    // 14. binary search for element 8 with std::lower_bound
+        // expected result: 5
+    std::cout << std::lower_bound(vec.begin(), vec.end(), 8) - vec.begin() << std::endl;
+
+    // 15. inserting several elements in the middle at once and appending a range
+    vec.insert(vec.begin() + 2, {40, 50, 60});
+    vec.append_range(container::Vector<int>{70, 80});
+        // expected result: 0, 1, 40, 50, 60, 3, 5, 7, 8, 9, 10, 20, 30, 70, 80
+    std::cout << vec << std::endl;
+
+    // 16. searching the container
+        // expected result: 1 1 0 0 80
+    std::cout << vec.count(40) << " " << vec.contains(50) << " " << vec.contains(90) << " "
+              << *vec.min_element() << " " << *vec.max_element() << std::endl;
+        // expected result: 6
+    std::cout << vec.find(5) - vec.begin() << std::endl;
+
+    // 17. constructing elements in place, also from an element of the full Vector itself
+    container::Vector<std::string> words;
+    words.emplace_back(3, 'a');
+    words.emplace_back("bb");
+    words.emplace_back(words[0], 1);
+    words.emplace_back(2, 'c');
+    words.emplace_back("dd");
+    words.emplace_back(words[0]);
+    words.emplace(words.begin() + 1, 2, 'z');
+        // expected result: aaa, zz, bb, aa, cc, dd, aaa, END
+    std::cout << words << std::endl;
+
+    // 18. growing a full Vector by emplace_back moves only the elements already stored
+    container::Vector<Tracked> tracked;
+    tracked.reserve(4);
+    for (int i = 0; i < 4; ++i) {
+        tracked.emplace_back(i);
+    }
+    Tracked::moves = 0;
+    tracked.emplace_back(4);
+        // expected result: 4 4
+    std::cout << Tracked::moves << " " << tracked[4].value << std::endl;
+
+    // 19. a Fixed_capacity Vector reports running out of room, also when inserting an rvalue
+    container::Vector<int, std::allocator<int>, container::Fixed_capacity<2>> fixed{1, 2};
+    try {
+        fixed.insert(fixed.cbegin(), 7);
+    } catch (const std::length_error &) {
+            // expected result: full 2
+        std::cout << "full " << fixed.size() << std::endl;
+    }
+
+    // 20. a Fixed_capacity Vector starting below its capacity allocates all of it at once
+    container::Vector<int, std::allocator<int>, container::Fixed_capacity<4>> fixed_four{1};
+    const int *fixed_data = fixed_four.data();
+    fixed_four.push_back(2);
+    fixed_four.push_back(3);
+    fixed_four.reserve(4);
+    try {
+        fixed_four.reserve(5);
+    } catch (const std::length_error &) {
+            // expected result: 4 1 3
+        std::cout << fixed_four.capacity() << " " << (fixed_four.data() == fixed_data) << " " << fixed_four.size() << std::endl;
+    }
+
+    // 21. min and max of a container long enough for the vectorized search,
+    // the first of equal elements is found, as with std::min_element and std::max_element
+    container::Vector<int> numbers;
+    for (int i = 0; i < 48; ++i) {
+        numbers.push_back((i * 37) % 101 - 50);
+    }
+    numbers[41] = -90;
+    numbers[45] = -90;
+    numbers[19] = 90;
+    numbers[33] = 90;
+        // expected result: 41 19 41 19
+    std::cout << numbers.min_element() - numbers.begin() << " " << numbers.max_element() - numbers.begin() << " "
+              << std::min_element(numbers.begin(), numbers.end()) - numbers.begin() << " "
+              << std::max_element(numbers.begin(), numbers.end()) - numbers.begin() << std::endl;
+
+    // 22. -0.0 equals 0.0 and NaN compares false, the answers still match the std algorithms
+    container::Vector<double> reals;
+    for (int i = 0; i < 40; ++i) {
+        reals.push_back(i % 7 + 0.5);
+    }
+    reals[12] = -0.0;
+    reals[25] = 0.0;
+    reals[30] = 6.5;
+        // expected result: 12 6 12 6
+    std::cout << reals.min_element() - reals.begin() << " " << reals.max_element() - reals.begin() << " "
+              << std::min_element(reals.begin(), reals.end()) - reals.begin() << " "
+              << std::max_element(reals.begin(), reals.end()) - reals.begin() << std::endl;
+    reals[20] = std::numeric_limits<double>::quiet_NaN();
+        // expected result: 12 6 12 6
+    std::cout << reals.min_element() - reals.begin() << " " << reals.max_element() - reals.begin() << " "
+              << std::min_element(reals.begin(), reals.end()) - reals.begin() << " "
+              << std::max_element(reals.begin(), reals.end()) - reals.begin() << std::endl;
+    reals[0] = std::numeric_limits<double>::quiet_NaN();
+        // expected result: 0 0 0 0
+    std::cout << reals.min_element() - reals.begin() << " " << reals.max_element() - reals.begin() << " "
+              << std::min_element(reals.begin(), reals.end()) - reals.begin() << " "
+              << std::max_element(reals.begin(), reals.end()) - reals.begin() << std::endl;
+
     // Additional task 4. Implement an additional structure - an iterator,
     // encapsulating the logic for traversing the container
     // Example code that should work once implemented: